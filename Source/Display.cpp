@@ -376,7 +376,7 @@ void OledLabel::paint(juce::Graphics& g)
 void Display::reset()
 {
     // set attributes
-    int displayLength = (int)(time_scale->load() * core::settings::sample_rate);
+    int displayLength = (int)(time_scale->load() * core::settings::host_rate);
     ratio = (double)displayLength / (double)area.w;
     displayLength /= ratio;
     // resize buffers
@@ -384,7 +384,7 @@ void Display::reset()
     sampleData.resize(dataLength);
     newData.resize(dataLength);
     newlyPopped.resize(dataLength);
-    notInterpolatedData.resize(core::settings::sample_rate/core::settings::scope_fps);
+    notInterpolatedData.resize(core::settings::host_rate/core::settings::scope_fps);
     // fill all buffers with 0
     std::fill(sampleData.begin(), sampleData.end(), 0);
     std::fill(newlyPopped.begin(), newlyPopped.end(), 0);
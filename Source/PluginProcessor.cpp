@@ -23,6 +23,8 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "core/uid.hpp"
+#include "core/utility/rtcheck.hpp"
+#include <cmath>
 #include <cstdint>
 
 
@@ -41,25 +43,19 @@ Processor::Processor(): AudioProcessor
     matrix = new juce::AudioProcessorParameter*[core::grid.count(core::Control::input) * core::grid.count(core::Control::output)];
     sockets = std::make_unique<Sockets>(core::constraints::pbay, core::grid);
 
-    sockets->bay->on_connect = [this](uint32_t out)
-    {
-        auto uid = core::decode_uid(out);
-        auto idx = this->spiro.rack.index(uid.mt, uid.mp);
-        this->spiro.addConnection(idx);
-    };
-
-    sockets->bay->on_disconnect = [this](uint32_t out)
-    {
-        auto uid = core::decode_uid(out);
-        auto idx = this->spiro.rack.index(uid.mt, uid.mp);
-        this->spiro.removeConnection(idx);
-    };
+    sockets->bay->on_connect    = [this](uint32_t output, uint32_t input) { this->spiro.connect(output, input); };
+    sockets->bay->on_disconnect = [this](uint32_t, uint32_t input) { this->spiro.disconnect(input); };
+    sockets->bay->on_clear      = [this]() { this->spiro.compile(true); };
 
     spiro.bay = sockets->bay;
+    spiro.compile();
+    for(const auto& id: engine) tree.addParameterListener(id, this);
 }
 
 Processor::~Processor()
 {
+    for(const auto& id: engine) tree.removeParameterListener(id, this);
+    if(core::rt::enabled) core::rt::report(std::cout);
     delete[] matrix;
     delete[] parameters;
 }
@@ -123,6 +119,33 @@ juce::AudioProcessorValueTreeState::ParameterLayout Processor::createParameterLa
         ));
     }
 
+    layout.add(std::make_unique<juce::AudioParameterChoice>             // Helper threads of the engine, off unless asked for
+    (
+        "workers",
+        "WORKERS",
+        juce::StringArray { "OFF", "1", "2", "3" },
+        core::settings::workers,
+        juce::AudioParameterChoiceAttributes().withAutomatable(false)
+    ));
+
+    layout.add(std::make_unique<juce::AudioParameterChoice>             // Engine rate over host rate, changes the latency
+    (
+        "oversampling",
+        "OVERSAMPLING",
+        juce::StringArray { "1X", "2X", "4X", "8X" },
+        static_cast<int>(std::log2(core::settings::oversampling)),
+        juce::AudioParameterChoiceAttributes().withAutomatable(false)
+    ));
+
+    layout.add(std::make_unique<juce::AudioParameterChoice>             // Decimator preset, CPU against rejection
+    (
+        "quality",
+        "QUALITY",
+        juce::StringArray { "ECO", "STANDARD", "HIGH" },
+        core::settings::quality,
+        juce::AudioParameterChoiceAttributes().withAutomatable(false)
+    ));
+
     for(int i = 0; i < core::grid.count(core::Control::input) * core::grid.count(core::Control::output); ++i)
     {
         // auto uid = core::grid.getUID(i, core::Control::input);
@@ -242,7 +265,14 @@ bool Processor::loadPreset(juce::String presetName)
     {
         currentPresetName = presetName;
         juce::MemoryMappedFile file(presetFile, juce::MemoryMappedFile::readOnly);
+        juce::Array<float> kept;
+        for(const auto& id: engine) kept.add(tree.getRawParameterValue(id)->load());
         setStateInformation(file.getData(), int(file.getSize()));
+        for(int i = 0; i < engine.size(); ++i)                  // The instance keeps its engine
+        {
+            auto* p = tree.getParameter(engine[i]);
+            p->setValueNotifyingHost(p->convertTo0to1(kept[i]));
+        }
         suspendProcessing(false);
         return true;
     }
@@ -338,6 +368,31 @@ void Processor::reset()
 
 }
 
+/***************************************************************************************************************************
+* 
+*  Engine settings, applied with processing suspended: helper threads and the engine rate are set here.
+* 
+**************************************************************************************************************************/
+void Processor::configure()
+{
+    const bool suspended = isSuspended();
+    suspendProcessing(true);
+    if(getSampleRate() > 0.0)                                   // Rates are known once prepared
+    {
+        const int factor = 1 << static_cast<int>(tree.getRawParameterValue("oversampling")->load());
+        const auto quality = static_cast<core::Decimator::quality>(tree.getRawParameterValue("quality")->load());
+        spiro.oversample(static_cast<unsigned>(getSampleRate()), factor, quality);
+        setLatencySamples(spiro.latency());
+    }
+    spiro.parallel(static_cast<int>(tree.getRawParameterValue("workers")->load()));
+    suspendProcessing(suspended);
+}
+
+void Processor::parameterChanged(const juce::String&, float)
+{
+    configure();
+}
+
 void Processor::reloadParameters()
 {
     suspendProcessing(true);
@@ -357,20 +412,6 @@ void Processor::reloadParameters()
         parameters[i] = tree.getParameter(name);
     }
 
-    for(int i = 0; i < core::grid.count(core::Control::input); ++i)
-    {
-        auto uid = core::grid.getUID(i, core::Control::input);
-        auto idx = spiro.bay->get_index(core::encode_uid(uid));
-        spiro.bay->io[idx].com = &spiro.rack.at(static_cast<core::map::module::type>(uid.mt), uid.mp)->icv[uid.pp];
-    }
-
-    for(int i = 0; i < core::grid.count(core::Control::output); ++i)
-    {
-        auto uid = core::grid.getUID(i, core::Control::output);
-        auto idx = spiro.bay->get_index(core::encode_uid(uid));
-        spiro.bay->io[idx].data = &spiro.rack.at(static_cast<core::map::module::type>(uid.mt), uid.mp)->ocv[uid.pp];
-    }
-
     for(int i = 0; i < core::grid.count(core::Control::input) * core::grid.count(core::Control::output); ++i)
     {
         matrix[i] = tree.getParameter("mm" + juce::String(i));
@@ -391,7 +432,8 @@ void Processor::prepareToPlay(double sampleRate, int samplesPerBlock)
     std::cout<<"-- Processor: prepareToPlay()\n";
 
     core::settings::buffer_size = samplesPerBlock;
-    core::settings::sample_rate = sampleRate;
+    core::settings::host_rate   = sampleRate;
+    configure();
     std::cout<<"Samples per block : "<<samplesPerBlock<<"\n";
     std::cout<<"Sample rate       : "<<sampleRate<<"\n";
     buffer = std::make_shared<core::wavering<core::Point2D<float>>>(samplesPerBlock * 196 / core::settings::scope_fps);
@@ -413,14 +455,33 @@ void Processor::releaseResources()
 *  MIDI
 * 
 ******************************************************************************************************************************/
-void Processor::handleMIDI(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+static core::Event decode(const juce::MidiMessageMetadata& metadata) noexcept
 {
+    uint8_t status  = metadata.data[0];
+    uint8_t msb = (metadata.numBytes >= 2) ? metadata.data[1] : 0;
+    uint8_t lsb = (metadata.numBytes == 3) ? metadata.data[2] : 0;
+    return core::Event { metadata.samplePosition, status, msb, lsb };
+}
+
+int Processor::handleMIDI(const juce::MidiBuffer& midiMessages)
+{
+    int count = 0;
     for(const auto metadata : midiMessages) 
     {
-        uint8_t status  = metadata.data[0];
-        uint8_t msb = (metadata.numBytes >= 2) ? metadata.data[1] : 0;
-        uint8_t lsb = (metadata.numBytes == 3) ? metadata.data[2] : 0;
-        spiro.midiMessage(status, msb, lsb);
+        if(count == static_cast<int>(std::size(events))) break;
+        events[count++] = decode(metadata);
+    }
+    return count;
+}
+
+void Processor::flushMIDI(juce::MidiBuffer& midiMessages, const int count)
+{
+    int skip = count;
+    for(const auto metadata : midiMessages)                 // Past the capacity: behind every queued event, at the end of the block
+    {
+        if(skip-- > 0) continue;
+        const core::Event e = decode(metadata);
+        spiro.midiMessage(e.status, e.msb, e.lsb);
     }
     midiMessages.clear();
 }
@@ -432,21 +493,25 @@ void Processor::handleMIDI(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& m
 ******************************************************************************************************************************/
 void Processor::processBlock(juce::AudioBuffer<float>& data, juce::MidiBuffer& midiMessages)
 {
-	handleMIDI(data, midiMessages);
+	core::rt::Scope audio;
+	const int count = handleMIDI(midiMessages);
 	data.clear();
 	int samples = data.getNumSamples();
 	float* DataL = data.getWritePointer(0);
 	float* DataR = data.getWritePointer(1);
 
-	for(int i = 0; i < samples; i++)
+	spiro.render(samples, events, count, [&](const int offset, const int n)
 	{
-	    spiro.process();
-	    auto L = spiro.out[core::Spiro::stereo::l].load();
-	    auto R = spiro.out[core::Spiro::stereo::r].load();
-		DataL[i] = L * 0.2f;
-		DataR[i] = R * 0.2f;
-		buffer.get()->set(core::Point2D<float>{ L , R });
-	}
+	    for(int i = 0; i < n; i++)
+	    {
+	        auto L = spiro.out[core::Spiro::stereo::l][i];
+	        auto R = spiro.out[core::Spiro::stereo::r][i];
+	        DataL[offset + i] = L * 0.2f;
+	        DataR[offset + i] = R * 0.2f;
+	        buffer.get()->set(core::Point2D<float>{ L , R });
+	    }
+	});
+	flushMIDI(midiMessages, count);
 }
 
 
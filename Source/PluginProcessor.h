@@ -25,7 +25,7 @@
 #include "wavering.hpp"
 #include "spiro.hpp"
 
-class Processor: public juce::AudioProcessor
+class Processor: public juce::AudioProcessor, private juce::AudioProcessorValueTreeState::Listener
 {
     public:
         juce::AudioProcessorEditor* createEditor() override;
@@ -83,13 +83,18 @@ class Processor: public juce::AudioProcessor
         bool loadPreset(juce::String);
         void reset();
         void reloadParameters();
+        void parameterChanged(const juce::String&, float) override;
+        void configure();                                       // Engine settings from the tree
+        static inline const juce::StringArray engine { "workers", "oversampling", "quality" };    // Settings of the instance, not of a preset
 
         const juce::String getName() const override { return JucePlugin_Name; };
         const juce::String getProgramName (int index) override;
-        void handleMIDI(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages);
+        int handleMIDI(const juce::MidiBuffer& midiMessages);   // Events of the block, in frame order, up to the capacity
+        void flushMIDI(juce::MidiBuffer& midiMessages, const int);  // Events past the capacity, after the block, in order
 
         juce::AudioDeviceManager deviceManager;
         core::Spiro spiro;
+        core::Event events[1024];                               // MIDI of the current block
         std::unique_ptr<Sockets> sockets;
 
         std::shared_ptr<core::wavering<core::Point2D<float>>> buffer;
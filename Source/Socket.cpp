@@ -42,7 +42,7 @@ Sockets::Sockets(const core::Rectangle<int>& bounds, const core::Grid& o)
             static_cast<int>(f.x - bounds.x + XG + SR),
             static_cast<int>(f.y - bounds.y + SR)
         };
-        bay->set_socket(&offset, SR, hash, SOCKET_IN, i);
+        bay->set_socket(&offset, SR, hash, SOCKET_IN, i, o.control(o.getUID(i, core::Control::input))->flag & core::map::flag::poly);
     }
     std::cout  <<"---- Outputs...\n";
     for(int i = 0; i < outputs; ++i)
@@ -54,7 +54,7 @@ Sockets::Sockets(const core::Rectangle<int>& bounds, const core::Grid& o)
             static_cast<int>(f.x - bounds.x + XG + SR),
             static_cast<int>(f.y - bounds.y + SR)
         };
-        bay->set_socket(&offset, SR, hash, SOCKET_OUT, i);
+        bay->set_socket(&offset, SR, hash, SOCKET_OUT, i, o.control(o.getUID(i, core::Control::output))->flag & core::map::flag::poly);
     }
     bay->draw();
     std::cout  <<"-- Sockets initialized!\n";
@@ -92,12 +92,13 @@ void Sockets::drawCords(juce::Graphics& g, float alpha)
     for(int j = 0; j < bay->nodes; j++)
     {
         core::Point2D<float> prior, current = bay->io[j].cord.data[0];
+        const bool poly = bay->io[j].poly && (bay->io[j].to == nullptr || bay->io[j].to->poly);  // Voice bundle, drawn thicker
         bay->io[j].cord.focused ? g.setColour (colour_highlighted.withAlpha(alpha)) : g.setColour (colour_normal.withAlpha(alpha));
         for(int i = 0; i < bay->io[j].cord.iterations; i++)
         {
             prior = current;
             current = bay->io[j].cord.data[i];
-            g.drawLine(prior.x, prior.y, current.x, current.y, 2.0f);
+            g.drawLine(prior.x, prior.y, current.x, current.y, poly ? 3.5f : 2.0f);
         }
         if(bay->io[j].on) g.fillEllipse(bay->io[j].cord.data[0].x - (SR/2) - 1, bay->io[j].cord.data[0].y - (SR/2) - 1, SR + 1, SR + 1);
     }
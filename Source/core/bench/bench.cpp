@@ -0,0 +1,565 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "render/host.hpp"
+#include "constants.hpp"
+#include "grid.hpp"
+#include "utility/fastmath.hpp"
+#include "utility/halfband.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/*****************************************************************************************************************************
+* 
+*  spiro_bench [options]
+*  module: every module type alone, per input state, waveform and voice count
+*  patch : reference patches through the whole engine
+*  math  : fastmath.hpp against libm, error over the stated range and ns per call; exits 1 past a stated bound,
+*          and the decimator impulse peak against its reported latency; exits 1 when they differ
+*  Times are ns per sample over several runs, rtf is the share of real time spent rendering.
+* 
+*****************************************************************************************************************************/
+using namespace core;
+using clock_type = std::chrono::steady_clock;
+
+struct Config
+{
+    unsigned rate  = 48000;
+    int runs       = 20;                                        // Timed runs per case
+    double seconds = 0.25;                                      // Audio per run
+    int threads    = 0;                                         // Helper threads for the patch level
+    bool json      = false;                                     // One JSON object per line
+    std::string only;                                           // Cases whose name contains this
+};
+
+struct Result { double mean, deviation, best; };                // ns per sample
+
+struct Case
+{
+    std::string name;
+    std::string variant;
+    std::function<void(Module<float>*)> setup;
+};
+
+static float noise[settings::block];                            // Stands in for a patched input
+static float chorus[settings::block][settings::poly];           // Stands in for a polyphonic cable
+static Lanes<float> bundle { chorus, 0 };
+static const bool loud = false;
+static Voices* roster = nullptr;                                // Voices of the engine under test
+
+template <typename F>
+static Result measure(const Config& o, F&& block)
+{
+    const int blocks = std::max(1, static_cast<int>(o.seconds * o.rate / settings::block));
+    for(int i = 0; i < blocks; ++i) block();                    // Warm up
+
+    std::vector<double> ns(o.runs);
+    for(auto& v: ns)
+    {
+        const auto start = clock_type::now();
+        for(int i = 0; i < blocks; ++i) block();
+        v = std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / (blocks * settings::block);
+    }
+
+    Result r { 0.0, 0.0, *std::min_element(ns.begin(), ns.end()) };
+    for(const auto v: ns) r.mean += v / ns.size();
+    for(const auto v: ns) r.deviation += (v - r.mean) * (v - r.mean) / ns.size();
+    r.deviation = std::sqrt(r.deviation);
+    return r;
+}
+
+static void report(const Config& o, const char* level, const std::string& name, const std::string& variant, const Result& r)
+{
+    const double rtf = r.mean * o.rate * 1.0e-9;
+    if(o.json)
+    {
+        std::printf("{\"level\":\"%s\",\"name\":\"%s\",\"case\":\"%s\",\"rate\":%u,\"ns_per_sample\":%.3f,\"stddev\":%.3f,\"min\":%.3f,\"rtf\":%.6f}\n",
+                    level, name.c_str(), variant.c_str(), o.rate, r.mean, r.deviation, r.best, rtf);
+    }
+    else std::printf("%-6s %-8s %-24s %12.2f %10.2f %12.2f %10.5f\n", level, name.c_str(), variant.c_str(), r.mean, r.deviation, r.best, rtf);
+    std::fflush(stdout);
+}
+
+static bool wanted(const Config& o, const std::string& name, const std::string& variant)
+{
+    return o.only.empty() || (name + " " + variant).find(o.only) != std::string::npos;
+}
+
+/*****************************************************************************************************************************
+* 
+*  Module level
+* 
+*****************************************************************************************************************************/
+static void feed(Module<float>* m, const bool fed)
+{
+    for(int i = 0; i < *m->descriptor->cv[map::cv::i]; ++i)
+    {
+        m->icv[i] = fed ? noise  : ground;
+        m->iqv[i] = fed ? &loud : &silent;
+        m->ilv[i] = &narrow;
+    }
+}
+
+static void release(Module<float>* m)
+{
+    if(auto* vco = dynamic_cast<VCO*>(m)) std::fill_n(vco->gate, settings::poly, false);
+    if(auto* env = dynamic_cast<ENV*>(m))
+    {
+        std::fill_n(env->gate, settings::poly, false);
+        std::fill_n(env->hold, settings::poly, false);
+    }
+    roster->clear();
+}
+
+static std::vector<Case> cases(const map::module::type type)
+{
+    std::vector<Case> list;
+    const char* state[] { "open", "fed" };
+    const int voices[] { 1, 8, settings::poly - 1 };
+
+    switch(type)
+    {
+        case map::module::type::vco:
+        {
+            const char* form[] { "tomisawa", "pulse", "hexagon" };
+            for(int f = 0; f < 3; ++f)
+            {
+                for(int s = 0; s < 2; ++s)
+                {
+                    list.push_back({ "vco", std::string(form[f]) + " mono " + state[s], [=](Module<float>* m)
+                    {
+                        auto* vco = static_cast<VCO*>(m);
+                        m->ccv[vco::ctl::form]->store(f);
+                        m->ccv[vco::ctl::mode]->store(VCO::Mono);
+                        vco->gate[VCO::Mono] = true;
+                        vco->note[VCO::Mono] = 60;
+                        feed(m, s);
+                    }});
+                    for(const int v: voices)
+                    {
+                        list.push_back({ "vco", std::string(form[f]) + " " + std::to_string(v) + "v " + state[s], [=](Module<float>* m)
+                        {
+                            auto* vco = static_cast<VCO*>(m);
+                            m->ccv[vco::ctl::form]->store(f);
+                            m->ccv[vco::ctl::mode]->store(VCO::Poly);
+                            for(int i = 1; i <= v; ++i)
+                            {
+                                const int voice = roster->allocate(36 + i, [](int) { return 0.0f; });
+                                vco->gate[voice] = true;
+                                vco->note[voice] = 36 + i;
+                            }
+                            feed(m, s);
+                        }});
+                    }
+                }
+            }
+            break;
+        }
+        case map::module::type::env:
+        {
+            for(const int v: voices)
+            {
+                list.push_back({ "env", std::to_string(v) + "v", [=](Module<float>* m)
+                {
+                    auto* env = static_cast<ENV*>(m);
+                    m->ccv[env::ctl::sa]->store(1.0f);
+                    m->ccv[env::ctl::scale]->store(1.0f);
+                    for(int i = 1; i <= v; ++i) env->start(1.0f, roster->allocate(36 + i, [](int) { return 0.0f; }));
+                }});
+            }
+            break;
+        }
+        case map::module::type::cso:
+        {
+            const char* solver[] = { "euler", "rk4", "adaptive" };
+            for(int f = 0; f < 4; ++f)
+            {
+                for(int k = 0; k < 3; ++k)
+                {
+                    for(int s = 0; s < 2; ++s)
+                    {
+                        list.push_back({ "cso", "form " + std::to_string(f) + " " + solver[k] + " " + state[s], [=](Module<float>* m)
+                        {
+                            m->ccv[cso::ctl::form]->store(f);
+                            m->ccv[cso::ctl::solver]->store(k);
+                            m->ccv[cso::ctl::mode]->store(CSO::Mono);
+                            feed(m, s);
+                        }});
+                    }
+                    for(const int v: voices)
+                    {
+                        list.push_back({ "cso", "form " + std::to_string(f) + " " + solver[k] + " " + std::to_string(v) + "v", [=](Module<float>* m)
+                        {
+                            auto* attractor = static_cast<CSO*>(m);
+                            m->ccv[cso::ctl::form]->store(f);
+                            m->ccv[cso::ctl::solver]->store(k);
+                            m->ccv[cso::ctl::mode]->store(CSO::Poly);
+                            for(int i = 1; i <= v; ++i) attractor->start(36 + i, roster->allocate(36 + i, [](int) { return 0.0f; }));
+                        }});
+                    }
+                }
+            }
+            break;
+        }
+        case map::module::type::vcf:
+        {
+            for(int s = 0; s < 2; ++s) list.push_back({ "vcf", state[s], [=](Module<float>* m) { feed(m, s); } });
+            list.push_back({ "vcf", "audio fed", [](Module<float>* m)           // Cutoff and Q on their knobs
+            {
+                feed(m, true);
+                m->icv[vcf::cvi::cutoff] = m->icv[vcf::cvi::Q] = ground;
+            }});
+            for(const int v: voices)
+            {
+                for(int s = 0; s < 2; ++s)
+                {
+                    list.push_back({ "vcf", std::to_string(v) + "v " + (s ? "fed" : "audio fed"), [=](Module<float>* m)
+                    {
+                        feed(m, true);
+                        bundle.width = v;
+                        m->ilv[vcf::cvi::a] = &bundle;
+                        if(!s) m->icv[vcf::cvi::cutoff] = m->icv[vcf::cvi::Q] = ground;
+                    }});
+                }
+            }
+            break;
+        }
+        case map::module::type::lfo:
+        {
+            for(int f = 0; f < 5; ++f)
+            {
+                for(int s = 0; s < 2; ++s)
+                {
+                    list.push_back({ "lfo", "form " + std::to_string(f) + " " + state[s], [=](Module<float>* m)
+                    {
+                        m->ccv[lfo::ctl::form]->store(f);
+                        feed(m, s);
+                    }});
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return list;
+}
+
+static void modules(const Config& o)
+{
+    Host host(o.rate, settings::block, 0);
+    roster = &host.spiro->voices;
+    bool seen[map::module::count] {};
+    for(int p = 0; p < grid.sectors; ++p)
+    {
+        Module<float>* m = host.spiro->rack.at(p);
+        const auto type = m->descriptor->type;
+        if(seen[type]) continue;
+        seen[type] = true;
+
+        auto list = cases(type);
+        if(list.empty())
+        {
+            for(int s = 0; s < 2; ++s) list.push_back({ *m->descriptor->prefix, s ? "fed" : "open", [=](Module<float>* m) { feed(m, s); } });
+        }
+        for(auto& c: list)
+        {
+            if(!wanted(o, c.name, c.variant)) continue;
+            c.setup(m);
+            m->snapshot(settings::block, 1.0f);
+            report(o, "module", c.name, c.variant, measure(o, [m] { m->process(settings::block); }));
+            release(m);
+            feed(m, false);
+        }
+    }
+}
+
+/*****************************************************************************************************************************
+* 
+*  Patch level
+* 
+*****************************************************************************************************************************/
+static void store(Host& host, const map::module::type t, const int p, const int c, const float v)
+{
+    host.spiro->rack.at(t, p)->ccv[c]->store(v);
+}
+
+static void pad(Host& host, const bool notes)         // 4 polyphonic VCOs through two SUMs into the mixer
+{
+    using mt = map::module::type;
+    for(int i = 0; i < 4; ++i)
+    {
+        store(host, mt::vco, i, vco::ctl::mode, VCO::Poly);
+        store(host, mt::vco, i, vco::ctl::form, i % 3);
+        store(host, mt::vco, i, vco::ctl::amp, 0.5f);
+        store(host, mt::env, i, env::ctl::at, 0.01f);
+        store(host, mt::env, i, env::ctl::aa, 1.0f);
+        store(host, mt::env, i, env::ctl::ha, 1.0f);
+        store(host, mt::env, i, env::ctl::da, 1.0f);
+        store(host, mt::env, i, env::ctl::sa, 1.0f);
+        store(host, mt::env, i, env::ctl::scale, 1.0f);
+        host.patch(encode_uid(mt::vco, i, map::cv::o, vco::cvo::main), encode_uid(mt::sum, i / 2, map::cv::i, i % 2 ? sum::cvi::b : sum::cvi::a));
+    }
+    host.patch(encode_uid(mt::sum, 0, map::cv::o, sum::cvo::a), encode_uid(mt::mix, 0, map::cv::i, mix::cvi::l));
+    host.patch(encode_uid(mt::sum, 1, map::cv::o, sum::cvo::a), encode_uid(mt::mix, 0, map::cv::i, mix::cvi::r));
+    store(host, mt::mix, 0, mix::ctl::amp, 1.0f);
+    if(notes) for(int i = 1; i < settings::poly; ++i) host.spiro->midiMessage(0x90, 36 + i, 100);
+}
+
+static void feedback(Host& host)                        // CSO into a rotator fed back through the delay
+{
+    using mt = map::module::type;
+    store(host, mt::cso, 0, cso::ctl::amp, 0.5f);
+    store(host, mt::cso, 0, cso::ctl::tune, 0.3f);
+    store(host, mt::vcd, 0, vcd::ctl::feed, 0.5f);
+    store(host, mt::mix, 0, mix::ctl::amp, 1.0f);
+    host.patch(encode_uid(mt::cso, 0, map::cv::o, cso::cvo::x), encode_uid(mt::rtr, 0, map::cv::i, rtr::cvi::ax));
+    host.patch(encode_uid(mt::cso, 0, map::cv::o, cso::cvo::y), encode_uid(mt::rtr, 0, map::cv::i, rtr::cvi::ay));
+    host.patch(encode_uid(mt::rtr, 0, map::cv::o, rtr::cvo::ax), encode_uid(mt::vcd, 0, map::cv::i, vcd::cvi::a));
+    host.patch(encode_uid(mt::vcd, 0, map::cv::o, vcd::cvo::a), encode_uid(mt::rtr, 0, map::cv::i, rtr::cvi::bx));
+    host.patch(encode_uid(mt::rtr, 0, map::cv::o, rtr::cvo::ay), encode_uid(mt::mix, 0, map::cv::i, mix::cvi::l));
+    host.patch(encode_uid(mt::vcd, 0, map::cv::o, vcd::cvo::b), encode_uid(mt::mix, 0, map::cv::i, mix::cvi::r));
+}
+
+static void patches(const Config& o)
+{
+    const std::pair<const char*, std::function<void(Host&)>> scenario[]
+    {
+        { "idle",     [](Host& h) { pad(h, false); } },
+        { "pad",      [](Host& h) { pad(h, true);  } },
+        { "feedback", [](Host& h) { feedback(h);   } },
+    };
+    std::vector<int> threads { 0 };
+    if(o.threads > 0) threads.push_back(o.threads);
+
+    for(const auto& [name, build]: scenario)
+    {
+        for(const int t: threads)
+        {
+            const std::string variant = std::to_string(t) + " helpers";
+            if(!wanted(o, name, variant)) continue;
+            Host host(o.rate, settings::block, t);
+            build(host);
+            auto& spiro = *host.spiro;
+            report(o, "patch", name, variant, measure(o, [&spiro] { spiro.process(settings::block); }));
+        }
+    }
+}
+
+/*****************************************************************************************************************************
+* 
+*  Math level
+*  Error is measured against double libm on 2^20 evenly spaced points, time on a buffer of points in the range:
+*  libm in float, fast:: on float, fast:: on simd::vf.
+* 
+*****************************************************************************************************************************/
+template <typename F>
+static double timed(const Config& o, F&& pass)                  // ns per call over a buffer of settings::block points
+{
+    double best = 1.0e30;
+    for(int r = 0; r < o.runs; ++r)
+    {
+        const auto start = clock_type::now();
+        for(int i = 0; i < 1000; ++i) pass();
+        best = std::min(best, std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / (1000.0 * settings::block));
+    }
+    return best;
+}
+
+template <typename Reference, typename Libm, typename Fast>
+static bool function(const Config& o, const char* name, const double low, const double high, const bool relative, const double bound,
+                     Reference&& reference, Libm&& libm, Fast&& fast)
+{
+    if(!wanted(o, name, "")) return true;
+
+    constexpr int points = 1 << 20;
+    double worst = 0.0;
+    alignas(32) float lane[simd::width];
+    for(int i = 0; i <= points; ++i)
+    {
+        const float x = static_cast<float>(low + (high - low) * i / points);
+        const double want = reference(static_cast<double>(x));
+        simd::store(lane, fast(simd::set(x)));
+        for(const double got: { static_cast<double>(fast(x)), static_cast<double>(lane[0]) })
+        {
+            double e = std::fabs(got - want);
+            if(relative) e /= std::max(std::fabs(want), 1.0e-30);
+            worst = std::max(worst, e);
+        }
+    }
+
+    alignas(32) float in[settings::block], out[settings::block];
+    for(int i = 0; i < settings::block; ++i) in[i] = static_cast<float>(low + (high - low) * (i + 0.5) / settings::block);
+    const double t0 = timed(o, [&] { for(int i = 0; i < settings::block; ++i) out[i] = libm(in[i]); asm volatile("" :: "r"(out) : "memory"); });
+    const double t1 = timed(o, [&] { for(int i = 0; i < settings::block; ++i) out[i] = fast(in[i]); asm volatile("" :: "r"(out) : "memory"); });
+    const double t2 = timed(o, [&]
+    {
+        for(int i = 0; i < settings::block; i += simd::width) simd::store(out + i, fast(simd::load(in + i)));
+        asm volatile("" :: "r"(out) : "memory");
+    });
+
+    const bool ok = worst <= bound;
+    char range[32];
+    std::snprintf(range, sizeof(range), "[%g, %g]", low, high);
+    if(o.json)
+    {
+        std::printf("{\"level\":\"math\",\"name\":\"%s\",\"low\":%g,\"high\":%g,\"error\":%.3e,\"relative\":%s,\"bound\":%.1e,"
+                    "\"libm_ns\":%.3f,\"fast_ns\":%.3f,\"simd_ns\":%.3f,\"pass\":%s}\n",
+                    name, low, high, worst, relative ? "true" : "false", bound, t0, t1, t2, ok ? "true" : "false");
+    }
+    else std::printf("%-6s %-8s %-24s %12.3e %10.3f %10.3f %10.3f %8.1e%s\n", "math", name, range, worst, t0, t1, t2, bound, ok ? "" : "  FAIL");
+    std::fflush(stdout);
+    return ok;
+}
+
+static bool functions(const Config& o)
+{
+    if(!o.json) std::printf("\n%-6s %-8s %-24s %12s %10s %10s %10s %8s\n", "level", "name", "range", "max error", "libm ns", "fast ns", "simd ns", "bound");
+    bool pass = true;
+    #define SPIRO_FUNCTION(f, low, high, relative, bound) pass &= function(o, #f, low, high, relative, bound, \
+        [](double x) { return std::f(x); }, [](float x) { return std::f(x); }, [](auto x) { return fast::f(x); })
+    SPIRO_FUNCTION(sin,  -tao,   tao,   false, 2.5e-7);
+    SPIRO_FUNCTION(cos,  -tao,   tao,   false, 2.5e-7);
+    SPIRO_FUNCTION(tan,  -1.3,   1.3,   true,  5.0e-7);
+    SPIRO_FUNCTION(atan, -64.0,  64.0,  false, 2.0e-7);
+    SPIRO_FUNCTION(exp2, -126.0, 126.0, true,  3.0e-7);
+    SPIRO_FUNCTION(exp,  -87.0,  87.0,  true,  4.0e-7);
+    SPIRO_FUNCTION(tanh, -10.0,  10.0,  false, 3.0e-7);
+    #undef SPIRO_FUNCTION
+    return pass;
+}
+
+/*****************************************************************************************************************************
+* 
+*  Decimator latency
+*  An impulse at the first engine frame must come out latency() host frames later: the host compensates by that much.
+*  The delay is read as the energy centroid of the response, the peak when the delay falls on a frame, and half way
+*  between the two highest frames when it falls between them.
+* 
+*****************************************************************************************************************************/
+static bool decimators(const Config& o)
+{
+    if(!o.json) std::printf("\n%-6s %-8s %-24s %12s %10s %10s\n", "level", "name", "case", "latency", "peak", "centroid");
+    bool pass = true;
+    static const char* quality[] { "eco", "standard", "high" };
+    for(const int factor: { 2, 4, 8 })
+    {
+        for(int q = Decimator::eco; q <= Decimator::high; ++q)
+        {
+            const std::string variant = std::to_string(factor) + "x " + quality[q];
+            if(!wanted(o, "decimate", variant)) continue;
+
+            Decimator d;
+            d.setup(factor, static_cast<Decimator::quality>(q));
+            const int frames = settings::block / factor;
+            float in[settings::block] {}, out[settings::block];
+            in[0] = 1.0f;
+            int peak = 0;
+            float top = 0.0f;
+            double energy = 0.0, moment = 0.0;
+            for(int b = 0; b < 8; ++b)
+            {
+                d.process(in, out, frames);
+                in[0] = 0.0f;
+                for(int s = 0; s < frames; ++s)
+                {
+                    const int t = b * frames + s;
+                    if(std::fabs(out[s]) > top) { top = std::fabs(out[s]); peak = t; }
+                    energy += static_cast<double>(out[s]) * out[s];
+                    moment += static_cast<double>(out[s]) * out[s] * t;
+                }
+            }
+
+            const double centroid = moment / energy;
+            const bool ok = std::fabs(centroid - d.latency()) <= 0.501 && std::abs(peak - d.latency()) <= 1;
+            if(o.json)
+            {
+                std::printf("{\"level\":\"math\",\"name\":\"decimate\",\"case\":\"%s\",\"latency\":%d,\"peak\":%d,\"centroid\":%.3f,\"pass\":%s}\n",
+                            variant.c_str(), d.latency(), peak, centroid, ok ? "true" : "false");
+            }
+            else std::printf("%-6s %-8s %-24s %12d %10d %10.3f%s\n", "math", "decimate", variant.c_str(), d.latency(), peak, centroid, ok ? "" : "  FAIL");
+            pass &= ok;
+        }
+    }
+    std::fflush(stdout);
+    return pass;
+}
+
+static int usage()
+{
+    std::fprintf(stderr,
+        "usage: spiro_bench [options] [module|patch|math]\n"
+        "  -r <hz>       sample rate                    (48000)\n"
+        "  -n <runs>     timed runs per case            (20)\n"
+        "  -s <seconds>  audio per run                  (0.25)\n"
+        "  -t <threads>  helper threads, patch level    (0)\n"
+        "  -k <text>     only cases whose name contains text\n"
+        "  -j            JSON lines\n");
+    return 2;
+}
+
+int main(int argc, char** argv)
+{
+    Config o;
+    std::string level;
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        if(a == "-j") o.json = true;
+        else if(a.size() == 2 && a[0] == '-')
+        {
+            if(++i >= argc) return usage();
+            switch(a[1])
+            {
+                case 'r': o.rate    = std::strtoul(argv[i], nullptr, 10); break;
+                case 'n': o.runs    = std::atoi(argv[i]);                 break;
+                case 's': o.seconds = std::atof(argv[i]);                 break;
+                case 't': o.threads = std::atoi(argv[i]);                 break;
+                case 'k': o.only    = argv[i];                            break;
+                default : return usage();
+            }
+        }
+        else if(level.empty() && (a == "module" || a == "patch" || a == "math")) level = a;
+        else return usage();
+    }
+    if(o.rate == 0 || o.runs <= 0 || o.seconds <= 0.0 || o.threads < 0) return usage();
+
+    std::cout.rdbuf(std::cerr.rdbuf());                         // Engine logs stay out of the report
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    for(auto& v: noise) v = uniform(random);
+    for(auto& frame: chorus) for(auto& v: frame) v = uniform(random);
+
+    if(!o.json) std::printf("%-6s %-8s %-24s %12s %10s %12s %10s\n", "level", "name", "case", "ns/sample", "stddev", "min", "rtf");
+    if(level.empty() || level == "module") modules(o);
+    if(level.empty() || level == "patch")  patches(o);
+    if(level.empty() || level == "math")   return functions(o) & decimators(o) ? 0 : 1;
+    return 0;
+}
@@ -124,6 +124,20 @@ namespace core
         };
 
         constexpr int sectors = std::size(sector_map);
+        constexpr int count(const Control::type ct)
+        {
+            int n = 0;
+            for(const auto& sector: sector_map)
+            {
+                for(int t = 0; t < map::cv::count; ++t)
+                {
+                    for(int e = 0; e < *sector.descriptor->cv[t]; ++e) n += sector.descriptor->set[t][e].is == ct;
+                }
+            }
+            return n;
+        }
+        constexpr int inputs  = count(Control::input);      // Patchbay input sockets
+        constexpr int outputs = count(Control::output);     // Patchbay output sockets
     }
 
 }
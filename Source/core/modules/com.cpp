@@ -26,13 +26,16 @@
 namespace core
 {
     using namespace com;
-    int COM::idc = 0;
 
-    void COM::process() noexcept
+    void COM::process(const int n) noexcept
     {
+        for(int i = 0; i < oc; ++i)
+        {
+            for(int s = 0; s < n; ++s) ocv[i][s] = wheel[i];
+        }
     };
 
-    COM::COM(): id(idc++), Module(idc, &com::descriptor)
+    COM::COM(const int p, Arena& arena): Module(p, &com::descriptor, arena), id(p)
     { 
     };
 }
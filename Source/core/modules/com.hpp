@@ -21,18 +21,17 @@
 ******************************************************************************************************************************/
 #pragma once
 #include "node.hpp"
+#include "com_interface.hpp"
 
 namespace core
 {
-    class COM: public Module<float>
+    class COM final: public Module<float>
     {
-        private:
-            static int idc;
-
         public:
             int id;
-            void process() noexcept override;
-            COM();
+            float wheel[com::oc] {};                    // Latest controller values
+            void process(const int) noexcept override;
+            COM(const int, Arena&);
            ~COM() = default;
     };
 }
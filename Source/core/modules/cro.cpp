@@ -27,14 +27,13 @@
 namespace core 
 {
     using namespace cro;
-    int CRO::idc = 0;
 
-    void CRO::process() noexcept
+    void CRO::process(const int) noexcept
     {
 
     }
 
-    CRO::CRO(): id(idc++), Module(idc, &cro::descriptor)    
+    CRO::CRO(const int p, Arena& arena): Module(p, &cro::descriptor, arena), id(p)    
     {
     }
 }
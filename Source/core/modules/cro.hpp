@@ -26,16 +26,13 @@
 
 namespace core
 {
-    class CRO: public Module<float>
+    class CRO final: public Module<float>
     {
-        private:
-            static int idc;
-
         public:
             const int id;
-            void process() noexcept override;
+            void process(const int) noexcept override;
 
-            CRO();
+            CRO(const int, Arena&);
            ~CRO() {};
     };
 
@@ -24,6 +24,8 @@
 #include "constants.hpp"
 #include "iospecs.hpp"
 #include "node.hpp"
+#include "setup/tuning.hpp"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -31,169 +33,427 @@ namespace core
 {
 using namespace cso;
 
-int CSO::idc = 0;
-
-void CSO::process() noexcept
+/******************************************************************************************************************************
+*   Systems
+*   field(): derivative of every axis at v, x y z in a group of four lanes. r1 = yzx(v) and r2 = zxy(v) put the other
+*   two axes beside each one: lane x sees y and z, lane y sees z and x, lane z sees x and y.
+*   dx(), dy(), dz(): the same field for voices, one axis per vector, one voice per lane.
+*   bias + slope * warp: the coefficient under warp. Time runs at rate * tune + rest per second, step is the longest
+*   step at 48 kHz. Output: (v - offset) * gain. Rates are twice the per tune rate of the first forms, which read tune
+*   twice through the fm slot: presets keep their speed now that fm is read from its input.
+******************************************************************************************************************************/
+namespace
 {
-    int f = ccv[ctl::form]->load();
-    if(prior != f) [[unlikely]]
+    using simd::vf;
+    using simd::triple;
+    using simd::set;
+
+    struct Axes { vf x, y, z; };
+
+    template <int F> struct System;
+
+    template <> struct System<0>                    // Sprott: x' = a y, y' = -y z - x, z' = b y^2 - c x - d
     {
-        (this->*reset[f])();
-        prior = f;
+        static constexpr float start[3] { 0.1f, 0.1f, 0.1f };
+        static constexpr float rate = 2000.0f, rest = 1.0f, gain = 0.4f, offset = 0.0f;
+        static constexpr float bias = 0.1f, slope = 1.0f;
+        static constexpr bool  rectify = false;
+        static vf field(const vf v, const float c) noexcept
+        {
+            const vf r1 = simd::yzx(v), r2 = simd::zxy(v);
+            return triple(0.8f, 0.0f, -c) * r1 + triple(0.0f, -1.0f, 0.0f) * (v * r1 + r2) + triple(0.0f, 0.0f, 0.5f) * (r2 * r2)
+                 + triple(0.0f, 0.0f, -1.0f);
+        }
+        static vf dx(const Axes& a, const vf)   noexcept { return set(0.8f) * a.y; }
+        static vf dy(const Axes& a, const vf)   noexcept { return set(0.0f) - a.y * a.z - a.x; }
+        static vf dz(const Axes& a, const vf c) noexcept { return set(0.5f) * a.y * a.y - c * a.x - set(1.0f); }
+    };
+
+    template <> struct System<1>                    // Helmholz: x' = y, y' = g z, z' = -z - d y - x - x^2
+    {
+        static constexpr float start[3] { 0.1f, 0.1f, 0.1f };
+        static constexpr float rate = 2000.0f, rest = 10.0f, gain = 3.0f, offset = 0.0f;
+        static constexpr float bias = 0.535f, slope = 0.03f;
+        static constexpr bool  rectify = true;
+        static vf field(const vf v, const float d) noexcept
+        {
+            const vf r1 = simd::yzx(v), r2 = simd::zxy(v);
+            return triple(1.0f, 5.11f, -1.0f) * r1 + triple(0.0f, 0.0f, -1.0f) * (v + r1 * r1) + triple(0.0f, 0.0f, -d) * r2;
+        }
+        static vf dx(const Axes& a, const vf)   noexcept { return a.y; }
+        static vf dy(const Axes& a, const vf)   noexcept { return set(5.11f) * a.z; }
+        static vf dz(const Axes& a, const vf d) noexcept { return set(0.0f) - a.z - d * a.y - a.x - a.x * a.x; }
+    };
+
+    template <> struct System<2>                    // Halvorsen: x' = -a x - 4 y - 4 z - y^2, and cyclic
+    {
+        static constexpr float start[3] { 0.1f, 0.0f, 0.0f };
+        static constexpr float rate = 400.0f, rest = 10.0f, gain = 0.5f, offset = 0.0f;
+        static constexpr float bias = 1.4f, slope = 1.0f;
+        static constexpr bool  rectify = true;
+        static vf field(const vf v, const float a) noexcept
+        {
+            const vf r1 = simd::yzx(v), r2 = simd::zxy(v);
+            return set(-a) * v - set(4.0f) * (r1 + r2) - r1 * r1;
+        }
+        static vf dx(const Axes& v, const vf a) noexcept { return set(0.0f) - a * v.x - set(4.0f) * (v.y + v.z) - v.y * v.y; }
+        static vf dy(const Axes& v, const vf a) noexcept { return set(0.0f) - a * v.y - set(4.0f) * (v.z + v.x) - v.z * v.z; }
+        static vf dz(const Axes& v, const vf a) noexcept { return set(0.0f) - a * v.z - set(4.0f) * (v.x + v.y) - v.x * v.x; }
+    };
+
+    template <> struct System<3>                    // Three scroll: x' = a (y - x) + b x z, y' = c y - x z, z' = d z + x y - e x^2
+    {
+        static constexpr float start[3] { 1.0f, 1.0f, 1.0f };
+        static constexpr float rate = 80.0f, rest = 1.0f, gain = 0.05f, offset = 45.0f;
+        static constexpr float bias = 0.55f, slope = 0.125f;
+        static constexpr bool  rectify = true;
+        static vf field(const vf v, const float e) noexcept
+        {
+            const vf r1 = simd::yzx(v), r2 = simd::zxy(v);
+            return triple(-40.0f, 20.0f, 0.833f) * v + triple(40.0f, 0.0f, 0.0f) * r1 + triple(0.5f, 0.0f, 0.0f) * (v * r2)
+                 + triple(0.0f, -1.0f, 1.0f) * (r1 * r2) + triple(0.0f, 0.0f, -e) * (r1 * r1);
+        }
+        static vf dx(const Axes& a, const vf)   noexcept { return set(40.0f) * (a.y - a.x) + set(0.5f) * a.x * a.z; }
+        static vf dy(const Axes& a, const vf)   noexcept { return set(20.0f) * a.y - a.x * a.z; }
+        static vf dz(const Axes& a, const vf e) noexcept { return set(0.833f) * a.z + a.x * a.y - e * a.x * a.x; }
+    };
+
+    template <int F>
+    constexpr float step = (System<F>::rate + System<F>::rest) / 48000.0f;
+    constexpr int substeps = 8;                     // Adaptive at most
+    constexpr float bound = 1.0e4f;                 // Far off any attractor
+
+    template <int F, CSO::Solver S>
+    vf advance(vf v, const float dt, const float p, const int m) noexcept
+    {
+        using Y = System<F>;
+        if constexpr(S == CSO::Euler)
+        {
+            v = v + triple(dt, 0.0f, 0.0f) * Y::field(v, p);
+            v = v + triple(0.0f, dt, 0.0f) * Y::field(v, p);
+            return v + triple(0.0f, 0.0f, dt) * Y::field(v, p);
+        }
+        else
+        {
+            const float h = dt / m;
+            for(int i = 0; i < m; ++i)
+            {
+                const vf k1 = Y::field(v, p);
+                const vf k2 = Y::field(v + set(h * 0.5f) * k1, p);
+                const vf k3 = Y::field(v + set(h * 0.5f) * k2, p);
+                const vf k4 = Y::field(v + set(h) * k3, p);
+                v = v + set(h / 6.0f) * (k1 + set(2.0f) * (k2 + k3) + k4);
+            }
+            return v;
+        }
+    }
+
+    template <int F>
+    Axes flow(const Axes& a, const vf p) noexcept
+    {
+        return { System<F>::dx(a, p), System<F>::dy(a, p), System<F>::dz(a, p) };
+    }
+
+    inline Axes along(const Axes& a, const vf h, const Axes& k) noexcept    // a + h k
+    {
+        return { a.x + h * k.x, a.y + h * k.y, a.z + h * k.z };
+    }
+
+    template <int F, CSO::Solver S>
+    Axes advance(Axes a, const vf dt, const vf p, const int m) noexcept
+    {
+        using Y = System<F>;
+        if constexpr(S == CSO::Euler)
+        {
+            a.x = a.x + dt * Y::dx(a, p);
+            a.y = a.y + dt * Y::dy(a, p);
+            a.z = a.z + dt * Y::dz(a, p);
+            return a;
+        }
+        else
+        {
+            const vf h = dt * set(1.0f / m), half = h * set(0.5f), sixth = h * set(1.0f / 6.0f);
+            for(int i = 0; i < m; ++i)
+            {
+                const Axes k1 = flow<F>(a, p);
+                const Axes k2 = flow<F>(along(a, half, k1), p);
+                const Axes k3 = flow<F>(along(a, half, k2), p);
+                const Axes k4 = flow<F>(along(a, h, k3), p);
+                const vf two = set(2.0f);
+                a = along(a, sixth, { k1.x + two * (k2.x + k3.x) + k4.x, k1.y + two * (k2.y + k3.y) + k4.y, k1.z + two * (k2.z + k3.z) + k4.z });
+            }
+            return a;
+        }
     }
-    (this->*form[f])();
 }
 
-void CSO::sprott_reset()
+void CSO::process(const int n) noexcept
 {
-    f[0] = 0.8f;     // a
-    f[1] = 0.5f;     // b
-    f[2] = 0.1f;     // c
-    f[3] = 1.0f;     // d
-    f[4] = 0.01f;    // t
-
-    f[5] = 0.1f;     // x
-    f[6] = 0.1f;     // y
-    f[7] = 0.1f;     // z
+    for(int k = 0; k < settings::shards; ++k) render(n, k);
+    gather(n);
 }
 
-void CSO::sprott() 
+void CSO::render(const int n, const int shard) noexcept
 {
-    f[4] = (ccv[ctl::tune]->load() + ccv[cvi::fm]->load()) * 1000.0f / settings::sample_rate + 1.0f / settings::sample_rate;
-    if(icv[cvi::warp] == &zero) f[2] = 0.1f + ccv[ctl::warp]->load();
-    else f[2] = 0.1f + ccv[ctl::warp]->load() * icv[cvi::warp]->load();
+    const Solver solver = static_cast<Solver>(rcv[ctl::solver].to);
+    if(mode() == Mono)
+    {
+        if(shard != 0) return;
+        switch(prior)
+        {
+            case 0:  run<0>(n, solver); break;
+            case 1:  run<1>(n, solver); break;
+            case 2:  run<2>(n, solver); break;
+            default: run<3>(n, solver); break;
+        }
+        return;
+    }
 
-    f[5] += f[4] * f[6] * f[0];
-    f[6] += f[4] * (- f[6] * f[7] - f[5]);
-    f[7] += f[4] * (f[1] * f[6] * f[6] - f[2] * f[5] - f[3]);
+    int id[settings::poly], count = 0;
+    for(int j = voices->first(shard); j < voices->last(shard); ++j) id[count++] = voices->list[j];
+    if(count == 0) return;
+    switch(prior)
+    {
+        case 0:  play<0>(id, count, n, solver); break;
+        case 1:  play<1>(id, count, n, solver); break;
+        case 2:  play<2>(id, count, n, solver); break;
+        default: play<3>(id, count, n, solver); break;
+    }
+}
 
-    if((f[5] > std::numeric_limits<float>::max()) && (f[6] > std::numeric_limits<float>::max()) && (f[7] > std::numeric_limits<float>::max())) 
+/******************************************************************************************************************************
+*   Outputs of the voices are the sum of their lanes, lanes of voices gone this block are silent.
+*   The form is taken here, between blocks, so that no shard reseeds voices another one is running.
+******************************************************************************************************************************/
+void CSO::gather(const int n) noexcept
+{
+    const int width = mode() == Poly ? voices->lanes : 0;
+    if(width > 0)
     {
-        f[5] = 0.1f; 
-        f[6] = 0.1f;
-        f[7] = 0.1f;
+        bool sounding[settings::poly] {};
+        for(int i = 0; i < voices->count; ++i) sounding[voices->list[i]] = true;
+        for(int o = 0; o < oc; ++o)
+        {
+            for(int s = 0; s < n; ++s)
+            {
+                float sum = 0.0f;
+                for(int v = 0; v < width; ++v) 
+                {
+                    if(!sounding[v]) bus[o][s][v] = 0.0f;
+                    sum += bus[o][s][v];
+                }
+                ocv[o][s] = sum;
+            }
+        }
     }
-    else
+    else if(mode() == Poly) for(int o = 0; o < oc; ++o) std::fill_n(ocv[o], n, 0.0f);
+    for(int o = 0; o < oc; ++o) olv[o].width = width;
+
+    const int f = rcv[ctl::form].to;
+    if(prior != f) [[unlikely]]
     {
-        ocv[cvo::x].store(f[5] * ccv[ctl::amp]->load() * 0.4f);
-        ocv[cvo::y].store(f[6] * ccv[ctl::amp]->load() * 0.4f);
-        ocv[cvo::z].store(f[7] * ccv[ctl::amp]->load() * 0.4f);
+        prior = f;
+        reset(f);
     }
 }
 
-void CSO::helmholz_reset()
+bool CSO::idle() noexcept
 {
-    f[5] = 0.1f;     // x
-    f[6] = 0.1f;     // y
-    f[7] = 0.1f;     // z
-
-    f[0] = 5.11f;    // Gamma
-    f[1] = 0.55f;    // Delta
-    f[2] = 0.01;     // t
+    return mode() == Poly && voices->count == 0;
 }
 
-void CSO::helmholz() 
+CSO::Mode CSO::mode() const noexcept
 {
-    f[2] = (ccv[ctl::tune]->load() + ccv[cvi::fm]->load()) * 1000.0f / settings::sample_rate + 10.0f/settings::sample_rate;
-    if(icv[cvi::warp] == &zero) f[1] = ((ccv[ctl::warp]->load() - 0.5f) * 0.03f) + 0.55f;
-    else f[1] = ((ccv[ctl::warp]->load() * fabsf(icv[cvi::warp]->load()) - 0.5f) * 0.03f) + 0.55f;
+    return static_cast<Mode>(ccv[ctl::mode]->load());
+}
 
-        f[5] += f[2] * f[6];
-        f[6] += f[2] * f[0] * f[7];
-        f[7] += f[2] * ( -f[7] - f[1] * f[6] - f[5] - f[5] * f[5] );
+void CSO::reset(const int f) noexcept
+{
+    static constexpr const float* start[forms] { System<0>::start, System<1>::start, System<2>::start, System<3>::start };
+    for(int k = 0; k < simd::width; ++k) point[k] = k % 4 < 3 ? start[f][k % 4] : 0.0f;
+    for(int v = 0; v < settings::poly; ++v) seed(v);
+}
 
-    if((f[5] > std::numeric_limits<float>::max()) && (f[6] > std::numeric_limits<float>::max()) && (f[7] > std::numeric_limits<float>::max())) 
+/******************************************************************************************************************************
+*   Voices start off the starting point of the form, moved by a few hundredths along each axis from their note:
+*   the same note always plays the same trajectory, neighbouring notes part soon after.
+******************************************************************************************************************************/
+void CSO::seed(const int v) noexcept
+{
+    static constexpr const float* start[forms] { System<0>::start, System<1>::start, System<2>::start, System<3>::start };
+    for(int j = 0; j < 3; ++j)
     {
-        f[5] = 0.1f; 
-        f[6] = 0.1f;
-        f[7] = 0.1f;
-    }
-    else
-    {     
-        ocv[cvo::x].store(f[5] * ccv[ctl::amp]->load() * 3.0f);
-        ocv[cvo::y].store(f[6] * ccv[ctl::amp]->load() * 3.0f);
-        ocv[cvo::z].store(f[7] * ccv[ctl::amp]->load() * 3.0f);
+        const float u = (note[v] + 1) * 0.618034f + j * 0.381966f;
+        axis[j][v] = start[prior][j] + (u - std::floor(u) - 0.5f) * 0.1f;
     }
 }
 
-void CSO::halvorsen_reset()
+void CSO::start(const uint8_t key, const int v) noexcept
 {
-    f[0] = 1.4f;     // a
-    f[1] = 0.01f;    // t
-
-    f[5] = 0.1f;     // x
-    f[6] = 0.0f;     // y
-    f[7] = 0.0f;     // z
-};
+    note[v]  = key;
+    speed[v] = Tuning::equal()[key] / Tuning::equal()[60];
+    seed(v);
+}
 
+template <int F>
+void CSO::run(const int n, const Solver solver) noexcept
+{
+    switch(solver)
+    {
+        case Euler:    integrate<F, Euler>(n);    break;
+        case RK4:      integrate<F, RK4>(n);      break;
+        default:       integrate<F, Adaptive>(n); break;
+    }
+}
 
-void CSO::halvorsen()
+template <int F>
+void CSO::play(const int* id, const int count, const int n, const Solver solver) noexcept
 {
-    f[1] = (ccv[ctl::tune]->load() + ccv[cvi::fm]->load()) * 200.0f / settings::sample_rate + 10.0f/settings::sample_rate;
-    if(icv[cvi::warp] == &zero) f[0] = 1.4f + ccv[ctl::warp]->load();
-    else f[0] = 1.4f + ccv[ctl::warp]->load() * fabsf(icv[cvi::warp]->load());
+    switch(solver)
+    {
+        case Euler:    kernel<F, Euler>(id, count, n);    break;
+        case RK4:      kernel<F, RK4>(id, count, n);      break;
+        default:       kernel<F, Adaptive>(id, count, n); break;
+    }
+}
 
-    f[5] += f[1] * ( - f[0] * f[5] - 4.0f * f[6] - 4.0f * f[7] - f[6] * f[6]);
-    f[6] += f[1] * ( - f[0] * f[6] - 4.0f * f[7] - 4.0f * f[5] - f[7] * f[7]);
-    f[7] += f[1] * ( - f[0] * f[7] - 4.0f * f[5] - 4.0f * f[6] - f[5] * f[5]);
+/******************************************************************************************************************************
+*   Kernel
+*   One step per sample over dt = (tune + fm) * rate / fs + rest / fs, the warp coefficient set per sample.
+*   Adaptive picks its number of steps once per block, from the largest dt of the block.
+******************************************************************************************************************************/
+template <int F, CSO::Solver S>
+void CSO::integrate(const int n) noexcept
+{
+    using Y = System<F>;
+    const Ramp<float>& tune = rcv[ctl::tune];
+    const Ramp<float>& warp = rcv[ctl::warp];
+    const Ramp<float>& amp  = rcv[ctl::amp];
+    const bool warped = icv[cvi::warp] != ground;
+    const float second = 1.0f / rate;
 
-    if((f[5] > std::numeric_limits<float>::max()) && (f[6] > std::numeric_limits<float>::max()) && (f[7] > std::numeric_limits<float>::max())) 
+    int m = 1;
+    if constexpr(S == Adaptive)
     {
-        f[5] = 0.1f; 
-        f[6] = 0.0f;
-        f[7] = 0.0f;
+        float longest = 0.0f;
+        for(int s = 0; s < n; ++s) longest = std::max(longest, tune[s] + icv[cvi::fm][s]);
+        longest = (longest * Y::rate + Y::rest) * second;
+        m = std::clamp(static_cast<int>(std::ceil(longest / step<F>)), 1, substeps);
     }
-    else
+
+    vf v = simd::load(point);
+    alignas(32) float p[simd::width];
+    for(int s = 0; s < n; ++s)
     {
-        ocv[cvo::x].store(f[5] * ccv[ctl::amp]->load() * 0.5f);
-        ocv[cvo::y].store(f[6] * ccv[ctl::amp]->load() * 0.5f);
-        ocv[cvo::z].store(f[7] * ccv[ctl::amp]->load() * 0.5f);
+        const float cv = warped ? (Y::rectify ? fabsf(icv[cvi::warp][s]) : icv[cvi::warp][s]) : 1.0f;
+        const float dt = ((tune[s] + icv[cvi::fm][s]) * Y::rate + Y::rest) * second;
+        v = advance<F, S>(v, dt, Y::bias + Y::slope * warp[s] * cv, m);
+
+        simd::store(p, v);
+        const float g = amp[s] * Y::gain;
+        ocv[cvo::x][s] = p[0] * g;
+        ocv[cvo::y][s] = p[1] * g;
+        ocv[cvo::z][s] = (p[2] - Y::offset) * g;
     }
+    simd::store(point, v);
 
+    if(!(std::fabs(point[0]) < bound && std::fabs(point[1]) < bound && std::fabs(point[2]) < bound)) [[unlikely]]
+    {
+        reset(F);
+        for(int o = 0; o < oc; ++o) std::fill_n(ocv[o], n, 0.0f);
+    }
 }
 
-void CSO::tsucs_reset()
+/******************************************************************************************************************************
+*   Voice kernel
+*   One lane per voice, its point loaded once, advanced over the block, then written back. Lanes past the last voice
+*   repeat the first one and are dropped. Time also runs at the pitch of the voice, fm and warp take polyphonic cables.
+*   Adaptive takes its number of steps from the fastest voice of the group. A voice thrown off is seeded again and
+*   silenced for the block.
+******************************************************************************************************************************/
+template <int F, CSO::Solver S>
+void CSO::kernel(const int* id, const int count, const int n) noexcept
 {
-    f[0] = 1.0f;     // x
-    f[1] = 1.0f;     // y
-    f[2] = 1.0f;     // z
+    using namespace simd;
+    using Y = System<F>;
+    const Ramp<float>& tune = rcv[ctl::tune];
+    const Ramp<float>& warp = rcv[ctl::warp];
+    const Ramp<float>& amp  = rcv[ctl::amp];
+    const Lanes<float>& fm = *ilv[cvi::fm];
+    const Lanes<float>& cv = *ilv[cvi::warp];
+    const bool warped = icv[cvi::warp] != ground;
+    const float second = 1.0f / rate;
 
-    f[3] = 40.00f;   // a
-    f[4] = 0.500f;   // b
-    f[5] = 20.00f;   // c
-    f[6] = 0.833f;   // d
-    f[7] = 0.650f;   // e
+    for(int g = 0; g < count; g += width)
+    {
+        alignas(32) float a[3][width], tempo[width], wide[2][width];
+        alignas(32) int lane[width];
+        const int used = std::min(width, count - g);
+        for(int k = 0; k < width; ++k)
+        {
+            lane[k] = id[g + (k < used ? k : 0)];
+            for(int j = 0; j < 3; ++j) a[j][k] = axis[j][lane[k]];
+            tempo[k]   = speed[lane[k]] * second;
+            wide[0][k] = lane[k] < fm.width ? 1.0f : 0.0f;
+            wide[1][k] = lane[k] < cv.width ? 1.0f : 0.0f;
+        }
 
-    f[8] = 0.001f;   // t
-};
+        int m = 1;
+        if constexpr(S == Adaptive)
+        {
+            float longest = 0.0f;
+            for(int s = 0; s < n; ++s)
+            {
+                for(int k = 0; k < used; ++k)
+                {
+                    const float f = fm.width > 0 ? fm.data[s][lane[k]] * wide[0][k] : icv[cvi::fm][s];
+                    longest = std::max(longest, ((tune[s] + f) * Y::rate + Y::rest) * tempo[k]);
+                }
+            }
+            m = std::clamp(static_cast<int>(std::ceil(longest / step<F>)), 1, substeps);
+        }
 
-void CSO::tsucs()
-{
-    if(icv[cvi::warp] == &zero) f[7] = ccv[ctl::warp]->load() / 8.0f + 0.55f;
-    else f[7] = ccv[ctl::warp]->load() * fabsf(icv[cvi::warp]->load())  / 8.0f + 0.55f;
-    double st = 1.0 / settings::sample_rate;
-    f[8] = (ccv[ctl::tune]->load() + ccv[cvi::fm]->load()) * st * 40.0 + st;
-
-        f[0] += f[8] * (f[3] * (f[1] - f[0]) + f[4] * f[0] * f[2]);
-        f[1] += f[8] * (f[5] *  f[1] - f[0]  * f[2]);
-        f[2] += f[8] * (f[6] *  f[2] + f[0]  * f[1] - f[7] * f[0] * f[0]);
- 
-    if((f[0] > std::numeric_limits<float>::max()) && (f[1] > std::numeric_limits<float>::max()) && (f[2] > std::numeric_limits<float>::max())) 
-    {
-        f[0] = 1.0f; 
-        f[1] = 1.0f;
-        f[2] = 1.0f;
-    }
-    else
-    {
-        ocv[cvo::x].store((f[0]) * ccv[ctl::amp]->load() * 0.05f);
-        ocv[cvo::y].store((f[1]) * ccv[ctl::amp]->load() * 0.05f);
-        ocv[cvo::z].store((f[2] - 45.0f) * ccv[ctl::amp]->load() * 0.05f);
+        const vi who = load(lane);
+        const vf pace = load(tempo), fmin = load(wide[0]), cvin = load(wide[1]);
+        Axes v { load(a[0]), load(a[1]), load(a[2]) };
+        for(int s = 0; s < n; ++s)
+        {
+            const vf f = fm.width > 0 ? simd::gather(fm.data[s], who) * fmin : set(icv[cvi::fm][s]);
+            vf w = set(1.0f);
+            if(warped)
+            {
+                w = cv.width > 0 ? simd::gather(cv.data[s], who) * cvin : set(icv[cvi::warp][s]);
+                if constexpr(Y::rectify) w = max(w, set(0.0f) - w);
+            }
+            const vf dt = ((set(tune[s]) + f) * set(Y::rate) + set(Y::rest)) * pace;
+            v = advance<F, S>(v, dt, set(Y::bias) + set(Y::slope * warp[s]) * w, m);
+
+            const vf k = set(amp[s] * Y::gain);
+            store(a[0], v.x * k);
+            store(a[1], v.y * k);
+            store(a[2], (v.z - set(Y::offset)) * k);
+            for(int j = 0; j < 3; ++j) for(int l = 0; l < used; ++l) bus[j][s][lane[l]] = a[j][l];
+        }
+
+        store(a[0], v.x);
+        store(a[1], v.y);
+        store(a[2], v.z);
+        for(int l = 0; l < used; ++l)
+        {
+            const int voice = lane[l];
+            for(int j = 0; j < 3; ++j) axis[j][voice] = a[j][l];
+            if(std::fabs(a[0][l]) < bound && std::fabs(a[1][l]) < bound && std::fabs(a[2][l]) < bound) [[likely]] continue;
+            seed(voice);
+            for(int j = 0; j < 3; ++j) for(int s = 0; s < n; ++s) bus[j][s][voice] = 0.0f;
+        }
     }
 }
 
-CSO::CSO(): id(idc++), Module(idc, &cso::descriptor[0])
+CSO::CSO(const int p, Arena& arena): Module(p, &cso::descriptor[0], arena), id(p)
 {
+    for(int v = 0; v < settings::poly; ++v) start(60, v);
+    reset(prior);
+    for(int o = 0; o < oc; ++o) olv[o].data = bus[o];
 }
 
 
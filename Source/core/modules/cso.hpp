@@ -22,51 +22,61 @@
 #pragma once
 #include "utility.hpp"
 #include "node.hpp"
+#include "voices.hpp"
+#include "utility/simd.hpp"
 
 namespace core 
 {
     inline const char* formCSO[] = { "SPROTT", "HELMHOLZ", "HALVORSEN", "TSUCS" };
 
-    class CSO: public Module<float>
+   /**************************************************************************************************************************
+    * 
+    *  CSO
+    *  Chaotic systems in three dimensions, every one a quadratic field advanced as one vector of x, y and z.
+    *  Euler, the default and the scheme of presets without a solver, is semi-implicit, each axis stepped from the
+    *  ones just updated. RK4 takes one fourth order step per sample, Adaptive splits it so that no step is longer
+    *  than the longest one at 48 kHz.
+    *  Points leaving the attractor, or not finite, are caught once per block and start over.
+    *  Poly runs one attractor per sounding voice instead, seeded from its note and sped up by its pitch,
+    *  the voices side by side in the lanes, one axis per vector. A form change lands after the block.
+    * 
+    **************************************************************************************************************************/
+    class CSO final: public Module<float>
     { 
         public:
             static const int forms { 4 };
+            enum Solver { Euler, RK4, Adaptive };
+            enum Mode { Mono, Poly };
 
         private:
-            static int idc;
-            float f[9];
+            alignas(32) float point[simd::width];       // x, y, z, 0, repeated over the lanes
+            alignas(32) float axis[3][settings::poly];  // x, y, z of every voice
+            float speed[settings::poly];                // Pitch of a voice over middle C
+            uint8_t note[settings::poly];               // Seed of a voice
+            float bus[3][settings::block][settings::poly];  // x, y, z lanes
             Limiter limiter;
-            void sprott_reset();
-            void helmholz_reset();
-            void halvorsen_reset();
-            void tsucs_reset();
-            int  prior = -1;
-
-            void (CSO::*reset[forms])() = 
-            { 
-                &CSO::sprott_reset,
-                &CSO::helmholz_reset,
-                &CSO::halvorsen_reset,
-                &CSO::tsucs_reset
-            };
-            
-            void sprott();
-            void helmholz();
-            void halvorsen();
-            void tsucs();
-
-            void (CSO::*form[forms])() = 
-            { 
-                &CSO::sprott,
-                &CSO::helmholz,
-                &CSO::halvorsen,
-                &CSO::tsucs
-            };
+            int  prior = 0;                             // Form of the points and voices
+            void reset(const int) noexcept;             // Starting point of a form, for every voice too
+            void seed(const int) noexcept;              // Starting point of a voice
+            template <int F>
+            void run(const int, const Solver) noexcept;
+            template <int F, Solver S>
+            void integrate(const int) noexcept;
+            template <int F>                            // Form F over a list of voices, simd::width at a time
+            void play(const int*, const int, const int, const Solver) noexcept;
+            template <int F, Solver S>
+            void kernel(const int*, const int, const int) noexcept;
 
         public:
             const int id = 0;
-            void process() noexcept override;
-            CSO();
+            const Voices* voices = nullptr;             // Sounding voices, set by Spiro
+            Mode mode() const noexcept;
+            void start(const uint8_t, const int) noexcept;  // Note, voice
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Poly without a voice
+            void render(const int, const int) noexcept;     // Voices of one shard
+            void gather(const int) noexcept;                // Sum of the lanes
+            CSO(const int, Arena&);
            ~CSO() = default;
     }; 
 } // Namespace core
@@ -23,12 +23,12 @@
 #include "env.hpp"
 #include "interface/env_interface.hpp"
 #include "vco.hpp"
+#include "utility/simd.hpp"
 #include <iostream>
+#include <utility>
 namespace core {
 using namespace env; 
 
-int ENV::idc = 0;
-
 inline float linearToLog(float value) noexcept
 {
     return std::pow(value, 2.0f);
@@ -37,18 +37,19 @@ inline float linearToLog(float value) noexcept
 void ENV::start(float velocity, int v) noexcept
 {
     stage[v] = ADSR::Attack;
+    gate[v] = true;
     hold[v] = true;
     departed[v] = 0;
     for(int i = 0; i < env::Segments - 1; ++i)
     {
         node[i + 1][v].L = linearToLog(ccv[ctl::aa + i]->load()) * value_scale * velocity;
-        node[i + 1][v].T = ccv[ctl::at + i]->load() * ccv[ctl::scale]->load() * core::settings::sample_rate;
+        node[i + 1][v].T = ccv[ctl::at + i]->load() * ccv[ctl::scale]->load() * rate;
         node[i + 1][v].F = ccv[ctl::af + i]->load();
     }
     theta[v] = node[stage[v]][v].L - node[stage[v] - 1][v].L;
     delta[v] = node[stage[v]][v].T - node[stage[v] - 1][v].T;
 
-    onStart(v);
+    event[v] = env::Event::Start;
 }
 
 void ENV::next_stage(int v) noexcept
@@ -57,7 +58,8 @@ void ENV::next_stage(int v) noexcept
     departed[v] = 0;
     if(stage[v] >= ADSR::Finish) 
     {
-        onFinish(v);
+        gate[v] = false;
+        event[v] = env::Event::Finish;
         stage[v] = ADSR::Start;
     }
     else
@@ -73,50 +75,137 @@ void ENV::jump(int target, int v) noexcept
     {
         departed[v] = 0;
         stage[v] = target;
-        node[stage[v] - 1][v].L = pin[v];
+        node[stage[v] - 1][v].L = level[v];
         theta[v] = node[stage[v]][v].L - node[stage[v] - 1][v].L;
         delta[v] = node[stage[v]][v].T - node[stage[v] - 1][v].T;
     }
 }
 
-void ENV::iterate(int v) noexcept
+/******************************************************************************************************************************
+*   Segment
+*   Every curve is B + S x + C (x - h)^3 over x = t / d, the in-out curve as two such pieces split at d / 2.
+*   It is handed to the kernel as forward differences at the departed sample: one step is three adds.
+*   Levels are evaluated afresh at the start of every block, so rounding does not build up along a long stage.
+*   Voices at rest or held on sustain are flat.
+******************************************************************************************************************************/
+ENV::Segment ENV::segment(const int v) const noexcept
 {
-    if(stage[v] > ADSR::Start && stage[v] < ADSR::Finish)
+    const int st = stage[v];
+    if(st <= ADSR::Start || st >= ADSR::Finish || (st == ADSR::Sustain && hold[v])) return { level[v], 0.0f, 0.0f, 0.0f, rest };
+
+    const uint d = delta[v], t = departed[v];
+    if(t >= d) return { level[v], 0.0f, 0.0f, 0.0f, 0 };     // Zero length stage, over at once
+
+    const float b = node[st - 1][v].L, c = theta[v];
+    float B = b, S = 0.0f, C = c, h = 0.0f;
+    uint end = d;
+    switch(static_cast<int>(node[st][v].F))
     {
-        if(stage[v] == ADSR::Sustain && hold[v]) {}
-        else
-        {
-            pin[v] =
-            (
-                ease[(int)node[stage[v]][v].F]
-                (
-                    (float)departed[v],
-                    node[stage[v] - 1][v].L,
-                    theta[v],
-                    (float)delta[v]
-                )
-            );
-            departed[v]++;
-            if (departed[v] >= delta[v]) next_stage(v);
-            ocv[env::cvo::a].store(pin[v]);
-        }
+        case 0:  S = c; C = 0.0f;       break;                  // fLinear
+        case 1:  B = b + c; h = 1.0f;   break;                  // fCubicOut
+        case 2:                         break;                  // fCubicIn
+        default:                                                // fCubicIO
+            C = 4.0f * c;
+            if(t < d - d / 2) end = d - d / 2;
+            else { B = b + c; h = 1.0f; }
     }
-    ocv[env::cvo::a].store(0.0f);
+
+    const float k = 1.0f / d;
+    const float x = t * k;
+    const float z = x - h;
+    return
+    {
+        B + S * x + C * z * z * z,
+        S * k + C * k * (3.0f * z * z + 3.0f * z * k + k * k),
+        6.0f * C * k * k * (z + k),
+        6.0f * C * k * k * k,
+        static_cast<int>(std::min(end - t, static_cast<uint>(rest - 1)))
+    };
 }
 
-void ENV::process() noexcept
+/******************************************************************************************************************************
+*   Kernel
+*   One voice per lane. The block runs in spans up to the next lane reaching the end of its curve,
+*   those lanes change stage, or in-out half, and the others carry on.
+******************************************************************************************************************************/
+void ENV::kernel(const int* id, const int used, const int n) noexcept
 {
-    for(int voice = 0; voice < settings::poly; ++voice) 
+    using namespace simd;
+    alignas(32) float y[width], d1[width], d2[width], d3[width], out[width];
+    int left[width];
+    for(int k = 0; k < width; ++k)
+    {
+        const Segment g = k < used ? segment(id[k]) : Segment { 0.0f, 0.0f, 0.0f, 0.0f, rest };
+        y[k] = g.y; d1[k] = g.d1; d2[k] = g.d2; d3[k] = g.d3; left[k] = g.left;
+    }
+
+    for(int s = 0;;)
     {
-        if(gate[voice]) 
+        int m = n - s;
+        for(int k = 0; k < used; ++k) m = std::min(m, left[k]);
+
+        vf a = load(y), b = load(d1), c = load(d2);
+        const vf e = load(d3);
+        for(const int end = s + m; s < end; ++s)
+        {
+            store(out, a);
+            for(int k = 0; k < used; ++k) pin[s][id[k]] = out[k];
+            a = a + b;
+            b = b + c;
+            c = c + e;
+        }
+        store(y, a); store(d1, b); store(d2, c);
+
+        for(int k = 0; k < used; ++k)
         {
-            iterate(voice);
+            const int v = id[k];
+            if(m > 0) level[v] = out[k];
+            if(left[k] == rest) continue;
+            departed[v] += m;
+            left[k] -= m;
+            if(left[k] > 0) continue;
+            if(departed[v] >= delta[v]) next_stage(v);
+            const Segment g = gate[v] ? segment(v) : Segment { 0.0f, 0.0f, 0.0f, 0.0f, rest };    // Finished: silent from here
+            y[k] = g.y; d1[k] = g.d1; d2[k] = g.d2; d3[k] = g.d3; left[k] = g.left;
         }
+        if(s == n) break;
+    }
+}
+
+void ENV::process(const int n) noexcept
+{
+    for(int k = 0; k < settings::shards; ++k) render(n, k);
+    gather(n);
+}
+
+void ENV::render(const int n, const int shard) noexcept
+{
+    int id[settings::poly], count = 0;
+    if(shard == 0 && gate[VCO::Mono]) id[count++] = VCO::Mono;
+    for(int i = voices->first(shard); i < voices->last(shard); ++i) 
+    {
+        if(gate[voices->list[i]]) id[count++] = voices->list[i];
+    }
+    for(int k = 0; k < count; ++k) drawn[id[k]] = true;
+    for(int g = 0; g < count; g += simd::width) kernel(id + g, std::min(simd::width, count - g), n);
+}
+
+void ENV::gather(const int n) noexcept
+{
+    std::fill_n(ocv[env::cvo::a], n, 0.0f);
+
+    const int width = std::max(voices->lanes, gate[VCO::Mono] ? 8 : 0);    // Lanes are pin, silent where not rendered
+    for(int v = 0; v < settings::poly; ++v)
+    {
+        if(std::exchange(drawn[v], false) || v >= width) continue;
+        for(int s = 0; s < n; ++s) pin[s][v] = 0.0f;
     }
+    olv[env::cvo::a].width = width;
 }
 
-core::ENV::ENV(): id(idc++), Module(idc, &env::descriptor[0])
+core::ENV::ENV(const int p, Arena& arena): Module(p, &env::descriptor[0], arena), id(p)
 {
+    olv[env::cvo::a].data = pin;
     for(int v = 0; v < settings::poly; ++v)
     {
         stage[v] = 0;
@@ -22,11 +22,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <set>
 #include <cstdlib>
 #include <cmath>
 #include <iostream>
-#include <functional>
 #include <atomic>
 #include <memory>
 #include "node.hpp"
@@ -49,35 +49,45 @@ namespace core
             Real L;
             Real F;
         };
+
+        enum class Event : uint8_t { None, Start, Finish };     // Voice lifecycle, read back by Spiro between passes
     };
 
-    class ENV: public Module<float>
+    class ENV final: public Module<float>
     {
         public:
             enum ADSR { Start, Attack, Decay, Sustain, Release, Finish };
-            std::function<void(int)> onStart;
-            std::function<void(int)> onFinish;
         private:
-            static int idc;  
             float theta[settings::poly]{};                      // Change in value_scale
             uint delta[settings::poly]{};                       // Time delta
             float time_multiplier; 
             uint departed[settings::poly]{};                    // Current sample
             int stage[settings::poly]{};                        // Current stage
             env::Node<float> node[env::Segments][settings::poly];
-            void iterate(int) noexcept;
+            float level[settings::poly] {};                     // Current level
+            bool drawn[settings::poly] {};                      // Rendered this block, lanes written by the kernel
+
+            struct Segment { float y, d1, d2, d3; int left; };  // Forward differences of the curve, samples left on it
+            static constexpr int rest = 0x7FFFFFFF;             // Samples left on a flat, held or idle voice
+            Segment segment(const int) const noexcept;          // From the current stage and departed
+            void kernel(const int*, const int, const int) noexcept;     // Up to simd::width voices over a block
 
         public:
-            float pin[settings::poly] {};
+            float pin[settings::block][settings::poly] {};      // Levels of the current block
             bool gate[settings::poly] {};                            // Active voice
             bool hold[settings::poly] {};
+            env::Event event[settings::poly] {};                // Last event of each voice since Spiro read it
+            const Voices* voices = nullptr;                     // Sounding voices, set by Spiro
+            float loudness(const int v) const noexcept { return level[v]; }     // Level of the last frame rendered
             const int id = 0;
             void next_stage(int) noexcept;
             void start(float, int) noexcept;          
             void jump(int, int) noexcept;                       // Jump to stage N 
-            void process() noexcept override;
+            void process(const int) noexcept override;
+            void render(const int, const int) noexcept;         // Voices of one shard
+            void gather(const int) noexcept;
             float value_scale = 1.0f;
-            ENV();
+            ENV(const int, Arena&);
            ~ENV() = default;
     };
 
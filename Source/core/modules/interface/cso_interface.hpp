@@ -13,12 +13,12 @@ namespace core
     **********************************************************************************************************************/
     namespace cso 
     {
-        constexpr int cc { 5 };
+        constexpr int cc { 7 };
         constexpr int ic { 2 };
         constexpr int oc { 3 };
         constexpr int vc { 2 };
 
-        struct ctl { enum { tune, warp, amp, form, options    }; };             // Controls
+        struct ctl { enum { tune, warp, amp, form, solver, mode, options }; };       // Controls
         struct cvi { enum { fm, warp                          }; };             // CV in
         struct cvo { enum { x, y, z                           }; };             // CV out
 
@@ -27,16 +27,16 @@ namespace core
         constexpr core::Control set_i[ic]
         {
         // -- TYPE ---------------------------- X ------ Y ------ W ------ H ------ ID ------- MIN -- MAX -- DEF -- SKEW - STEP -- RAD - SYM -- FLAG --------
-            { Control::type::input    , {  49.00f, 239.00f,  16.00f,  16.00f }, "fm"     , 0.00f, 1.00f, 0.00f, 0.20f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::input    , {  10.00f, 239.00f,  16.00f,  16.00f }, "warp"   , 0.00f, 1.00f, 0.00f, 0.20f, 0.000f, 0x00, false, 0x00000000  },
+            { Control::type::input    , {  49.00f, 239.00f,  16.00f,  16.00f }, "fm"     , 0.00f, 1.00f, 0.00f, 0.20f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::input    , {  10.00f, 239.00f,  16.00f,  16.00f }, "warp"   , 0.00f, 1.00f, 0.00f, 0.20f, 0.000f, 0x00, false, map::flag::poly  },
         };
         
         constexpr core::Control set_o[oc]
         {
         // -- TYPE ---------------------------- X ------ Y ------ W ------ H ------ ID ------- MIN -- MAX -- DEF -- SKEW - STEP -- RAD - SYM -- FLAG --------
-            { Control::type::output   , {  30.00f, 269.00f,  16.00f,  16.00f }, "x"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::output   , {  30.00f, 299.00f,  16.00f,  16.00f }, "y"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::output   , {  30.00f, 329.00f,  16.00f,  16.00f }, "z"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
+            { Control::type::output   , {  30.00f, 269.00f,  16.00f,  16.00f }, "x"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::output   , {  30.00f, 299.00f,  16.00f,  16.00f }, "y"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::output   , {  30.00f, 329.00f,  16.00f,  16.00f }, "z"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
         };
 
         constexpr core::Control set_c[vc][cc]
@@ -47,6 +47,8 @@ namespace core
                 { Control::type::slider   , {  14.00f, 108.00f,  48.00f,  48.00f }, "warp"   , 0.00f, 1.00f, 0.00f, 0.20f, 0.001f, 0x00, false, map::flag::A        },
                 { Control::type::slider   , {  22.00f, 177.00f,  32.00f,  32.00f }, "amp"    , 0.00f, 1.00f, 0.00f, 0.20f, 0.001f, 0x00, false, map::flag::B        },
                 { Control::type::parameter, {   0.00f,   0.00f,   0.00f,   0.00f }, "form"   , 0.00f, 3.00f, 0.00f, 0.50f, 1.000f, 0x00, false, 0x00000000          },
+                { Control::type::parameter, {   0.00f,   0.00f,   0.00f,   0.00f }, "solver" , 0.00f, 2.00f, 0.00f, 0.50f, 1.000f, 0x00, false, 0x00000000          },
+                { Control::type::parameter, {   0.00f,   0.00f,   0.00f,   0.00f }, "mode"   , 0.00f, 1.00f, 0.00f, 0.50f, 1.000f, 0x00, false, 0x00000000          },
                 { Control::type::button   , { 120.00f,   5.00f,  12.00f,  12.00f }, "options", 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0xFF, false, map::flag::radio    },
             },
             {
@@ -55,6 +57,8 @@ namespace core
                 { Control::type::slider   , {  14.00f, 108.00f,  48.00f,  48.00f }, "warp"   , 0.00f, 1.00f, 0.00f, 0.20f, 0.001f, 0x00, false, map::flag::A        },
                 { Control::type::slider   , {  22.00f, 177.00f,  32.00f,  32.00f }, "amp"    , 0.00f, 1.00f, 0.00f, 0.20f, 0.001f, 0x00, false, map::flag::B        },
                 { Control::type::parameter, {   0.00f,   0.00f,   0.00f,   0.00f }, "form"   , 0.00f, 3.00f, 0.00f, 0.50f, 1.000f, 0x00, false, 0x00000000          },
+                { Control::type::parameter, {   0.00f,   0.00f,   0.00f,   0.00f }, "solver" , 0.00f, 2.00f, 0.00f, 0.50f, 1.000f, 0x00, false, 0x00000000          },
+                { Control::type::parameter, {   0.00f,   0.00f,   0.00f,   0.00f }, "mode"   , 0.00f, 1.00f, 0.00f, 0.50f, 1.000f, 0x00, false, 0x00000000          },
                 { Control::type::button   , {  60.00f,   5.00f,  12.00f,  12.00f }, "options", 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0xFF, false, map::flag::radio    },
             }
         };
@@ -86,18 +90,22 @@ namespace core
         *  Options
         * 
         **********************************************************************************************************************/
-        constexpr std::string_view parameterId[]    = { "FORM:" };
-        constexpr Options::type parameterType[]     = { Options::Choice };
+        constexpr std::string_view parameterId[]    = { "FORM  :",
+                                                        "SOLVER:",
+                                                        "MODE  :" };
+        constexpr Options::type parameterType[]     = { Options::Choice, Options::Choice, Options::Choice };
         constexpr std::string_view waveforms[]      = { "SPROTT", "HELMHOLZ", "HALVORSEN", "3SCROLL" };
-        constexpr const std::string_view* const choice[] = { waveforms };
-        constexpr uint8_t parameterPosition[] = { static_cast<uint8_t>(ctl::form) };
+        constexpr std::string_view solvers[]        = { "EULER", "RK4", "ADAPTIVE" };
+        constexpr std::string_view modes[]          = { "MONO", "POLY" };
+        constexpr const std::string_view* const choice[] = { waveforms, solvers, modes };
+        constexpr uint8_t parameterPosition[] = { static_cast<uint8_t>(ctl::form), static_cast<uint8_t>(ctl::solver), static_cast<uint8_t>(ctl::mode) };
         constexpr Options options 
         { 
             "DYNAMIC SYSTEM", 
             parameterId, 
             parameterType,
             parameterPosition, 
-            1, 
+            3, 
             choice 
         };
     }
@@ -31,7 +31,8 @@ namespace core
                 toggle      = 1 << 3,
                 momentary   = 1 << 4,
                 radio       = 1 << 5,
-                fader       = 1 << 6
+                fader       = 1 << 6,
+                poly        = 1 << 7                    // Port carries one lane per voice
             };
         };
     }
@@ -39,6 +40,7 @@ namespace core
     struct Control
     {
         enum  type                        { slider, button, parameter, input, output, pin, count };
+        enum  glide                       { hold, linear, pole };   // Per block: jump, ramp, one-pole ramp
         const Control::type     is        { parameter };
         const Rectangle<float>  constrain { 0.0f, 0.0f, 0.0f, 0.0f };
         const std::string       postfix   { "fuse" };
@@ -54,6 +56,8 @@ namespace core
         const bool  symmetric   { false };
 
         const uint32_t flag     { 0     };                      // Control specific settings
+
+        const Control::glide smooth { is != slider ? hold : flag & map::flag::encoder ? pole : linear };
     };
 
     struct Descriptor 
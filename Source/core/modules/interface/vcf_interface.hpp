@@ -24,19 +24,19 @@ namespace core
         constexpr core::Control set_i[ic]
         {
         // -- TYPE ---------------------------- X ------ Y ------ W ------ H ------ ID ------- MIN -- MAX -- DEF -- SKEW - STEP -- RAD - SYM -- FLAG --------
-            { Control::type::input    , {  11.00f,  37.00f,  16.00f,  16.00f }, "a"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::input    , {  11.00f,  67.00f,  16.00f,  16.00f }, "b"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::input    , {  11.00f,  97.00f,  16.00f,  16.00f }, "c"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::input    , {  11.00f, 127.00f,  16.00f,  16.00f }, "cutoff" , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::input    , {  49.00f, 127.00f,  16.00f,  16.00f }, "Q"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
+            { Control::type::input    , {  11.00f,  37.00f,  16.00f,  16.00f }, "a"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::input    , {  11.00f,  67.00f,  16.00f,  16.00f }, "b"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::input    , {  11.00f,  97.00f,  16.00f,  16.00f }, "c"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::input    , {  11.00f, 127.00f,  16.00f,  16.00f }, "cutoff" , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::input    , {  49.00f, 127.00f,  16.00f,  16.00f }, "Q"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
         };
         
         constexpr core::Control set_o[oc]
         {
         // -- TYPE ---------------------------- X ------ Y ------ W ------ H ------ ID ------- MIN -- MAX -- DEF -- SKEW - STEP -- RAD - SYM -- FLAG --------
-            { Control::type::output   , {  49.00f,  37.00f,  16.00f,  16.00f }, "lp"     , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::output   , {  49.00f,  67.00f,  16.00f,  16.00f }, "bp"     , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
-            { Control::type::output   , {  49.00f,  97.00f,  16.00f,  16.00f }, "hp"     , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000  },
+            { Control::type::output   , {  49.00f,  37.00f,  16.00f,  16.00f }, "lp"     , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::output   , {  49.00f,  67.00f,  16.00f,  16.00f }, "bp"     , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
+            { Control::type::output   , {  49.00f,  97.00f,  16.00f,  16.00f }, "hp"     , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly  },
         };
 
         constexpr core::Control set_c[cc]
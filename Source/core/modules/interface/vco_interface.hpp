@@ -35,7 +35,7 @@ namespace core
         constexpr core::Control set_o[oc]
         {
         // -- TYPE ---------------------------- X ------ Y ------ W ------ H ------ ID ----- MIN -- MAX -- DEF - SKEW -- STEP - RAD -- SYM ------ FLAG ----------
-            { Control::type::output   , { 106.00f, 269.00f,  16.00f,  16.00f }, "a"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, 0x00000000          },
+            { Control::type::output   , { 106.00f, 269.00f,  16.00f,  16.00f }, "a"      , 0.00f, 1.00f, 0.00f, 0.50f, 0.000f, 0x00, false, map::flag::poly          },
         };
 
         constexpr core::Control set_c[cc]
@@ -23,62 +23,62 @@
 #include "interface/lfo_interface.hpp"
 #include "lfo_interface.hpp"
 #include "node.hpp"
+#include "fastmath.hpp"
 
 namespace core
 {
-    int LFO::idc = 0;
-
-    void LFO::process() noexcept
+    void LFO::process(const int n) noexcept
     {
-        float o = (this->*form[(int)ccv[lfo::ctl::form]->load()])();
-        ocv[lfo::cvo::a].store(o);
-        ocv[lfo::cvo::b].store(o);
+        auto f = form[(int)rcv[lfo::ctl::form].to];
+        for(int s = 0; s < n; ++s)
+        {
+            float o = (this->*f)(s);
+            ocv[lfo::cvo::a][s] = o;
+            ocv[lfo::cvo::b][s] = o;
+        }
     }
 
-    float LFO::sine()
+    float LFO::sine(const int s)
     {
-        phase += (*ccv[lfo::ctl::delta] + fabsf(*icv[lfo::cvi::fm])) * (*ccv[lfo::ctl::scale] + 0.001f) * tao / settings::sample_rate;
+        phase += (rcv[lfo::ctl::delta][s] + fabsf(icv[lfo::cvi::fm][s])) * (rcv[lfo::ctl::scale][s] + 0.001f) * tao / rate;
         if(phase > pi) phase -= tao;
-        return cosf(phase) * ccv[lfo::ctl::amp]->load() * (icv[lfo::cvi::am] == &zero ? 1.0f : icv[lfo::cvi::am]->load());
+        return fast::cos(phase) * rcv[lfo::ctl::amp][s] * (icv[lfo::cvi::am] == ground ? 1.0f : icv[lfo::cvi::am][s]);
     }
 
-    float LFO::ramp()
+    float LFO::ramp(const int s)                                // atan(tan(x)) is x itself for x on (-pi / 2, pi / 2]
     {
-        phase += (*ccv[lfo::ctl::delta] + fabsf(*icv[lfo::cvi::fm])) * (*ccv[lfo::ctl::scale] + 0.001f) * tao / settings::sample_rate;
+        phase += (rcv[lfo::ctl::delta][s] + fabsf(icv[lfo::cvi::fm][s])) * (rcv[lfo::ctl::scale][s] + 0.001f) * tao / rate;
         if(phase > pi) phase -= tao;
-        return atanf(tanf(phase * 0.5f)) * ccv[lfo::ctl::amp]->load() * (icv[lfo::cvi::am] == &zero ? 1.0f : icv[lfo::cvi::am]->load());
+        return phase * 0.5f * rcv[lfo::ctl::amp][s] * (icv[lfo::cvi::am] == ground ? 1.0f : icv[lfo::cvi::am][s]);
     }
 
-    float LFO::saw()
+    float LFO::saw(const int s)                                 // and atan(tan(pi - x)) is -x, pi folded back
     {
-        phase += ( *ccv[lfo::ctl::delta] + fabsf(*icv[lfo::cvi::fm]) ) * (*ccv[lfo::ctl::scale] + 0.001f) * tao / settings::sample_rate;
+        phase += ( rcv[lfo::ctl::delta][s] + fabsf(icv[lfo::cvi::fm][s]) ) * (rcv[lfo::ctl::scale][s] + 0.001f) * tao / rate;
         if(phase > pi) phase -= tao;
-        return atanf(tanf(pi - phase * 0.5f)) * ccv[lfo::ctl::amp]->load() * (icv[lfo::cvi::am] == &zero ? 1.0f : icv[lfo::cvi::am]->load());
+        return phase * -0.5f * rcv[lfo::ctl::amp][s] * (icv[lfo::cvi::am] == ground ? 1.0f : icv[lfo::cvi::am][s]);
     }
 
-    float LFO::square()
+    float LFO::square(const int s)
     {
-        phase += ( *ccv[lfo::ctl::delta] + fabsf(*icv[lfo::cvi::fm]) ) * (*ccv[lfo::ctl::scale] + 0.001f) * tao / settings::sample_rate;
+        phase += ( rcv[lfo::ctl::delta][s] + fabsf(icv[lfo::cvi::fm][s]) ) * (rcv[lfo::ctl::scale][s] + 0.001f) * tao / rate;
         if(phase > pi) phase -= tao;
-        return (phase > 0.0f ? 1.0f : 0.0f) * ccv[lfo::ctl::amp]->load() * (icv[lfo::cvi::am] == &zero ? 1.0f : icv[lfo::cvi::am]->load());
+        return (phase > 0.0f ? 1.0f : 0.0f) * rcv[lfo::ctl::amp][s] * (icv[lfo::cvi::am] == ground ? 1.0f : icv[lfo::cvi::am][s]);
     }
 
-    float LFO::triangle()
+    float LFO::triangle(const int s)
     {
-        phase += ( *ccv[lfo::ctl::delta] + fabsf(*icv[lfo::cvi::fm]) ) * (*ccv[lfo::ctl::scale] + 0.001f) * tao / settings::sample_rate;
+        phase += ( rcv[lfo::ctl::delta][s] + fabsf(icv[lfo::cvi::fm][s]) ) * (rcv[lfo::ctl::scale][s] + 0.001f) * tao / rate;
         if(phase > pi) phase -= tao;
-        return tan(sin(phase)) * ccv[lfo::ctl::amp]->load() * (icv[lfo::cvi::am] == &zero ? 1.0f : icv[lfo::cvi::am]->load()) * 0.65f;
+        return fast::tan(std::sin(phase)) * rcv[lfo::ctl::amp][s] * (icv[lfo::cvi::am] == ground ? 1.0f : icv[lfo::cvi::am][s]) * 0.65f;
     }
 
     void LFO::reset()
     {
         phase = 0.0f;
-        for(int i = 0; i < lfo::cc; ++i) ccv[i] = &zero;
-        for(int i = 0; i < lfo::ic; ++i) icv[i] = &zero;
-        for(int i = 0; i < lfo::oc; ++i) ocv[i].store(0.0f);
     }
 
-    LFO::LFO(): id(idc++), Module(idc, &lfo::descriptor)
+    LFO::LFO(const int p, Arena& arena): Module(p, &lfo::descriptor, arena), id(p)
     {
         reset();
     };
@@ -28,20 +28,19 @@
 
 namespace core 
 {
-    class LFO: public Module<float>
+    class LFO final: public Module<float>
     {
         public:
             static const int forms = 5;
         private:
-            static int idc;
             float phase = 0.0f;
-            float sine();
-            float ramp();
-            float saw();
-            float square();
-            float triangle();
+            float sine(const int);
+            float ramp(const int);
+            float saw(const int);
+            float square(const int);
+            float triangle(const int);
 
-            float (LFO::*form[forms])() = 
+            float (LFO::*form[forms])(const int) = 
             { 
                 &LFO::sine,
                 &LFO::square,
@@ -52,9 +51,9 @@ namespace core
 
         public:
             const int id = 0;
-            void process() noexcept override;
+            void process(const int) noexcept override;
             void reset();
-            LFO();
+            LFO(const int, Arena&);
            ~LFO() = default;
     }; 
 
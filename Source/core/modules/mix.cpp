@@ -28,24 +28,35 @@
 namespace core 
 {
     using namespace mix;
-    int MIX::idc = 0;
 
-    void MIX::process() noexcept
+    void MIX::process(const int n) noexcept
     {
-        Point3D<float> a 
-        { 
-            icv[cvi::l]->load(), 
-            icv[cvi::c]->load(), 
-            icv[cvi::r]->load() 
-        };
-        float lc = ccv[ctl::alpha]->load() + icv[cvi::alpha]->load();
-        float cr = ccv[ctl::theta]->load() + icv[cvi::theta]->load();
-        Point2D<float> lr = c3c2(a, lc, cr);
-        ocv[cvo::l].store(lr.x * ccv[ctl::amp]->load());
-        ocv[cvo::r].store(lr.y * ccv[ctl::amp]->load());
+        const Ramp<float>& alpha = rcv[ctl::alpha];
+        const Ramp<float>& theta = rcv[ctl::theta];
+        const Ramp<float>& amp   = rcv[ctl::amp];
+
+        for(int s = 0; s < n; ++s)
+        {
+            Point3D<float> a 
+            { 
+                icv[cvi::l][s], 
+                icv[cvi::c][s], 
+                icv[cvi::r][s] 
+            };
+            float lc = alpha[s] + icv[cvi::alpha][s];
+            float cr = theta[s] + icv[cvi::theta][s];
+            Point2D<float> lr = c3c2(a, lc, cr);
+            ocv[cvo::l][s] = lr.x * amp[s];
+            ocv[cvo::r][s] = lr.y * amp[s];
+        }
+    }
+
+    bool MIX::idle() noexcept
+    {
+        return *iqv[cvi::l] && *iqv[cvi::c] && *iqv[cvi::r];
     }
 
-    MIX::MIX(): id(idc++), Module(idc, &mix::descriptor)
+    MIX::MIX(const int p, Arena& arena): Module(p, &mix::descriptor, arena), id(p)
     {
     }
 }
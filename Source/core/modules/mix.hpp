@@ -24,16 +24,14 @@
 
 namespace core
 {
-    class MIX: public Module<float>
+    class MIX final: public Module<float>
     {
-        private:
-            static int idc;
-
         public:
             const int id;
-            void process() noexcept override;
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Silent channels
 
-            MIX();
+            MIX(const int, Arena&);
            ~MIX() {};
     };
 
@@ -1,27 +1,77 @@
 #include "node.hpp"
 #include "constants.hpp"
+#include <algorithm>
 
 namespace core
 {
     template<typename T>
-    Module<T>::Module(const int id, const Descriptor* d): position(id), descriptor(d)
+    Module<T>::Module(const int id, const Descriptor* d, Arena& arena): position(id), descriptor(d)
     {
-        ccv = new std::atomic<T>*[*descriptor->cv[map::cv::c]];
-        icv = new std::atomic<T>*[*descriptor->cv[map::cv::i]];
-        ocv = new std::atomic<T> [*descriptor->cv[map::cv::o]];
+        const int oc = *descriptor->cv[map::cv::o];
 
-        for(int i = 0; i < *descriptor->cv[map::cv::i]; ++i) icv[i] = &zero;
+        icv = arena.hot.take<const T*>(*descriptor->cv[map::cv::i]);
+        T* buffer = arena.hot.take<T>(oc * settings::block);
+        ccv = arena.cold.take<std::atomic<T>*>(*descriptor->cv[map::cv::c]);
+        rcv = arena.hot.take<Ramp<T>>(*descriptor->cv[map::cv::c]);
+        ocv = arena.cold.take<T*>(oc);
+        iqv = arena.cold.take<const bool*>(*descriptor->cv[map::cv::i]);
+        oqv = arena.cold.take<bool>(oc);
+        ilv = arena.cold.take<const Lanes<T>*>(*descriptor->cv[map::cv::i]);
+        olv = arena.cold.take<Lanes<T>>(oc);
+
+        for(int i = 0; i < oc; ++i) ocv[i] = buffer + i * settings::block;
+        for(int i = 0; i < *descriptor->cv[map::cv::i]; ++i) icv[i] = ground;
+        for(int i = 0; i < *descriptor->cv[map::cv::i]; ++i) iqv[i] = &silent;
+        for(int i = 0; i < *descriptor->cv[map::cv::i]; ++i) ilv[i] = &narrow;
         for(int i = 0; i < *descriptor->cv[map::cv::c]; ++i) ccv[i] = &zero;
-        for(int i = 0; i < *descriptor->cv[map::cv::o]; ++i) ocv[i].store(0.0f);
+    }
+
+   /**************************************************************************************************************************
+    * 
+    *  Read every control once for a block of n frames and ramp from the previous block.
+    *  k: one-pole coefficient for that block length.
+    * 
+    **************************************************************************************************************************/
+    template<typename T>
+    void Module<T>::snapshot(const int n, const T k) noexcept
+    {
+        for(int i = 0; i < *descriptor->cv[map::cv::c]; ++i)
+        {
+            const T target = ccv[i]->load(std::memory_order_relaxed);
+            Ramp<T>& r = rcv[i];
+            const T last = primed ? r.to : target;
+
+            const auto smooth = descriptor->set[map::cv::c][i].smooth;
+            r.to   = smooth == Control::pole ? last + (target - last) * k : target;
+            r.step = smooth == Control::hold ? T {} : (r.to - last) / n;
+            r.from = r.to - r.step * (n - 1);
+        }
+        primed = true;
     }
 
     template<typename T>
-    Module<T>::~Module()
+    void Module<T>::sleep() noexcept
     {
-        delete[] ocv;
-        delete[] icv;
-        delete[] ccv;
+        if(asleep) return;
+        asleep = true;
+        for(int i = 0; i < *descriptor->cv[map::cv::o]; ++i)
+        {
+            std::fill_n(ocv[i], settings::block, T {});
+            oqv[i] = true;
+            olv[i].width = 0;
+        }
     }
 
+    template<typename T>
+    void Module<T>::wake() noexcept
+    {
+        if(!asleep) return;
+        asleep = false;
+        for(int i = 0; i < *descriptor->cv[map::cv::o]; ++i) oqv[i] = false;
+    }
+
+    template<typename T>
+    Module<T>::~Module() = default;
+
     template class Module<float>;
 }
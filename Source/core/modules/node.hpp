@@ -1,21 +1,60 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
 #include <functional>
+#include "arena.hpp"
 #include "descriptor.hxx"
 
 namespace core
 {
     template<typename T>
-    struct Module
+    struct Ramp                                     // Control value over the current block
+    {
+        T from = 0;                                 // First frame
+        T step = 0;                                 // Per frame
+        T to   = 0;                                 // Last frame
+        T operator[](const int s) const noexcept { return from + step * s; }
+    };
+
+    template<typename T>
+    struct Lanes                                    // Voice bundle of a polyphonic output
+    {
+        T (*data)[settings::poly] = nullptr;        // [settings::block][settings::poly], lanes of a frame are contiguous
+        int width = 0;                              // Lanes in use this block, 0: mono cable
+    };
+
+    inline const Lanes<float> narrow {};            // Lanes of a mono or unpatched input
+
+    template<typename T>
+    inline void spread(T* to, const Lanes<T>& in, const T* mono, const int s, const int w) noexcept  // Frame s of a control input over w lanes
+    {
+        if(in.width == 0) return (void)std::fill_n(to, w, mono[s]);
+        std::copy_n(in.data[s], in.width, to);
+        std::fill(to + in.width, to + w, T {});
+    }
+
+    template<typename T>
+    struct alignas(cacheline) Module
     {
             const Descriptor* const descriptor;
             const int position;
             std::atomic<T>** ccv;                   // Controls
-            std::atomic<T>** icv;                   // Inputs
-            std::atomic<T>*  ocv;                   // Outputs
-            virtual void process() noexcept = 0;
-            Module(const int, const Descriptor*);
+            Ramp<T>* rcv;                           // Controls, ramped from the last snapshot
+            const T** icv;                          // Inputs  [settings::block]
+            T** ocv;                                // Outputs [settings::block]
+            const bool** iqv;                       // Inputs silent this block
+            bool* oqv;                              // Outputs silent this block
+            const Lanes<T>** ilv;                   // Inputs lanes, width 0 unless fed by a polyphonic cable
+            Lanes<T>* olv;                          // Outputs lanes, the output buffer holds their sum
+            unsigned rate = settings::rate;         // Engine frames per second, set by Rack::clock
+            bool asleep = false;
+            bool primed = false;                    // First snapshot jumps to the values
+            void snapshot(const int, const T) noexcept;
+            void sleep() noexcept;                  // Zero the outputs once, flag them silent and mono
+            void wake() noexcept;
+            virtual void process(const int) noexcept = 0;
+            Module(const int, const Descriptor*, Arena&);
+            Module(const Module&) = delete;
             virtual ~Module();
     };
 }
-
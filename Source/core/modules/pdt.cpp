@@ -25,26 +25,39 @@
 #include "pdt_interface.hpp"
 
 namespace core {
-    
-    int PDT::idc = 0;
 
-    void PDT::process() noexcept
+    void PDT::process(const int n) noexcept
     {
-        bool  o = false;
-        float s = 1.0f;
-        for(int i = 0; i < pdt::ic; ++i)
+        for(int s = 0; s < n; ++s)
         {
-            if(icv[i] == &zero) continue;
-            else 
+            bool  o = false;
+            float p = 1.0f;
+            for(int i = 0; i < pdt::ic; ++i)
             {
-                s *= icv[i]->load();
-                o = true;
+                if(icv[i] == ground) continue;
+                else 
+                {
+                    p *= icv[i][s];
+                    o = true;
+                }
             }
+            ocv[0][s] = o ? p : 0.0f;
         }
-        ocv[0].store( o ? s : 0.0f);
     };
 
-    PDT::PDT(): id(idc++), Module(idc, &pdt::descriptor)
+    bool PDT::idle() noexcept
+    {
+        bool patched = false;
+        for(int i = 0; i < pdt::ic; ++i)
+        {
+            if(icv[i] == ground) continue;
+            if(*iqv[i]) return true;
+            patched = true;
+        }
+        return !patched;
+    }
+
+    PDT::PDT(const int p, Arena& arena): Module(p, &pdt::descriptor, arena), id(p)
     { 
     };
 }
@@ -24,15 +24,13 @@
 
 namespace core
 {
-    class PDT: public Module<float>
+    class PDT final: public Module<float>
     {
-        private:
-            static int idc;
-
         public:
             const int id;
-            void process() noexcept override;
-            PDT();
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // A silent factor
+            PDT(const int, Arena&);
            ~PDT() = default;
     };
 
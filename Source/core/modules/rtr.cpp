@@ -26,37 +26,48 @@
 namespace core 
 {
     using namespace rtr;
-    int RTR::idc = 0;
     
-    void RTR::process() noexcept
+    void RTR::process(const int n) noexcept
     {
-        Point3D<float> a 
-        { 
-            icv[cvi::ax]->load() + 
-            icv[cvi::bx]->load(),
-            icv[cvi::ay]->load() +
-            icv[cvi::by]->load(),
-            icv[cvi::az]->load() +
-            icv[cvi::bz]->load() 
-        };
-
-        float x = ccv[ctl::x]->load() + pi * icv[cvi::cvx]->load();
-        float y = ccv[ctl::y]->load() + pi * icv[cvi::cvy]->load();
-        float z = ccv[ctl::z]->load() + pi * icv[cvi::cvz]->load();
-
-        q.from_euler(x, y, z);
-        q.rotate_vector(a.x, a.y, a.z);
-
-        ocv[cvo::ax].store(a.x);
-        ocv[cvo::ay].store(a.y);
-        ocv[cvo::az].store(a.z);
-        ocv[cvo::bx].store(a.x);
-        ocv[cvo::by].store(a.y);
-        ocv[cvo::bz].store(a.z);
+        const Ramp<float>& cx = rcv[ctl::x];
+        const Ramp<float>& cy = rcv[ctl::y];
+        const Ramp<float>& cz = rcv[ctl::z];
 
+        for(int s = 0; s < n; ++s)
+        {
+            Point3D<float> a 
+            { 
+                icv[cvi::ax][s] + 
+                icv[cvi::bx][s],
+                icv[cvi::ay][s] +
+                icv[cvi::by][s],
+                icv[cvi::az][s] +
+                icv[cvi::bz][s] 
+            };
+
+            float x = cx[s] + pi * icv[cvi::cvx][s];
+            float y = cy[s] + pi * icv[cvi::cvy][s];
+            float z = cz[s] + pi * icv[cvi::cvz][s];
+
+            q.from_euler(x, y, z);
+            q.rotate_vector(a.x, a.y, a.z);
+
+            ocv[cvo::ax][s] = a.x;
+            ocv[cvo::ay][s] = a.y;
+            ocv[cvo::az][s] = a.z;
+            ocv[cvo::bx][s] = a.x;
+            ocv[cvo::by][s] = a.y;
+            ocv[cvo::bz][s] = a.z;
+        }
+    }
+
+    bool RTR::idle() noexcept
+    {
+        return *iqv[cvi::ax] && *iqv[cvi::ay] && *iqv[cvi::az] &&
+               *iqv[cvi::bx] && *iqv[cvi::by] && *iqv[cvi::bz];
     }
 
-    RTR::RTR(): id(idc++), Module(idc, &rtr::descriptor)
+    RTR::RTR(const int p, Arena& arena): Module(p, &rtr::descriptor, arena), id(p)
     { 
     };
 
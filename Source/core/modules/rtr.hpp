@@ -25,16 +25,16 @@
 
 namespace core
 {
-    class RTR: public Module<float>
+    class RTR final: public Module<float>
     {
         private:
-            static int idc;
             Quaternion q;
 
         public:
             int id;
-            void process() noexcept override;
-            RTR();
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Silent vectors
+            RTR(const int, Arena&);
            ~RTR() = default;
     };
 
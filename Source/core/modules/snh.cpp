@@ -29,22 +29,30 @@ namespace core
 {
     using namespace snh;
 
-int SNH::idc = 0;
-
-void SNH::process() noexcept
+void SNH::process(const int n) noexcept
 {
-    const float epsilon = 1.0f / settings::sample_rate;
-    const float t_scale = scale * (float(settings::sample_rate) / 1000.0f);
-    const float base = 1.0f - std::pow(ccv[ctl::time]->load(), 1.5f) * 0.995f;
-    const float factor = icv[cvi::time] != &zero ? base * fabsf(icv[cvi::time]->load()) : base;
+    const float epsilon = 1.0f / rate;
+    const float t_scale = scale * (float(rate) / 1000.0f);
+    const float base = 1.0f - std::pow(rcv[ctl::time].to, 1.5f) * 0.995f;
 
-    if (t > t_scale + epsilon)
+    for(int s = 0; s < n; ++s)
     {
-        t = 0.0f;
-        ocv[cvo::a].store(icv[cvi::a]->load() + icv[cvi::b]->load());
+        const float factor = icv[cvi::time] != ground ? base * fabsf(icv[cvi::time][s]) : base;
+
+        if (t > t_scale + epsilon)
+        {
+            t = 0.0f;
+            value = icv[cvi::a][s] + icv[cvi::b][s];
+        }
+        ocv[cvo::a][s] = value;
+
+        t += factor;
     }
+}
 
-    t += factor;
+bool SNH::idle() noexcept
+{
+    return *iqv[cvi::a] && *iqv[cvi::b] && value == 0.0f;
 }
 
 void SNH::reset()
@@ -54,7 +62,7 @@ void SNH::reset()
     scale = 40.0f;
 }
 
-SNH::SNH(): id(idc++), Module(idc, &snh::descriptor[0])
+SNH::SNH(const int p, Arena& arena): Module(p, &snh::descriptor[0], arena), id(p)
 {
     reset();
 }
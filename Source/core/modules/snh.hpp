@@ -24,19 +24,19 @@
 
 namespace core 
 {
-    class SNH: public Module<float>
+    class SNH final: public Module<float>
     {
         private:
-            static int idc;
             float t     = 0.0f;
             float value = 0.0f;
             float scale = 40.0f; // TODO
 
         public:
             int id;
-            void process() noexcept override;
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Silent inputs, nothing held
             void reset();
-            SNH();
+            SNH(const int, Arena&);
            ~SNH() = default;
     };
 
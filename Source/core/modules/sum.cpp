@@ -26,15 +26,22 @@
 namespace core
 {
     using namespace sum;
-    int SUM::idc = 0;
 
-    void SUM::process() noexcept
+    void SUM::process(const int n) noexcept
     {
-        ocv[cvo::a].store(icv[cvi::a]->load() + icv[cvi::b]->load());
-        ocv[cvo::b].store(ocv[cvo::a]);
+        for(int s = 0; s < n; ++s)
+        {
+            ocv[cvo::a][s] = icv[cvi::a][s] + icv[cvi::b][s];
+            ocv[cvo::b][s] = ocv[cvo::a][s];
+        }
     };
 
-    SUM::SUM(): id(idc++), Module(idc, &sum::descriptor[0])
+    bool SUM::idle() noexcept
+    {
+        return *iqv[cvi::a] && *iqv[cvi::b];
+    }
+
+    SUM::SUM(const int p, Arena& arena): Module(p, &sum::descriptor[0], arena), id(p)
     { 
     };
 }
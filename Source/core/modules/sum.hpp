@@ -24,15 +24,13 @@
 
 namespace core
 {
-    class SUM: public Module<float>
+    class SUM final: public Module<float>
     {
-        private:
-            static int idc;
-
         public:
             int id;
-            void process() noexcept override;
-            SUM();
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Silent inputs
+            SUM(const int, Arena&);
            ~SUM() = default;
     };
 }
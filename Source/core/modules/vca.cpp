@@ -22,35 +22,92 @@
 #include "vca.hpp"
 #include "node.hpp"
 #include "vca_interface.hpp"
+#include "fastmath.hpp"
+#include <algorithm>
 
 namespace core 
 {
     using namespace vca;
-
-    int VCA::idc = 0;
     
     inline float sigmoid_amp(float x) 
     {
-        return 0.5f * (std::tanh(2.0f * x) + 1.0f);
+        return 0.5f * (fast::tanh(2.0f * x) + 1.0f);
     }
 
-    void VCA::process() noexcept
+    void VCA::process(const int n) noexcept
     {
-        float v = 0.0f;
-        if(icv[cvi::amp] == &zero)
+        const int width = std::max({ ilv[cvi::a]->width, ilv[cvi::b]->width, ilv[cvi::amp]->width });
+        olv[cvo::a].width = width;
+        olv[cvo::b].width = width;
+        if(width > 0) return voices(n, width);
+
+        const Ramp<float>& amp = rcv[ctl::amp];
+        for(int s = 0; s < n; ++s)
         {
-            v = ccv[ctl::amp]->load();
+            float v = 0.0f;
+            if(icv[cvi::amp] == ground)
+            {
+                v = amp[s];
+            }
+            else 
+            {
+                v = amp[s] * sigmoid_amp(icv[cvi::amp][s]);
+            }
+            float o = (icv[cvi::a][s] + icv[cvi::b][s]) * v; 
+            ocv[cvo::a][s] = o;
+            ocv[cvo::b][s] = o;
         }
-        else 
+    };
+
+   /**************************************************************************************************************************
+    * 
+    *  Polyphonic cable on any input: mono audio enters lane 0, a mono amp applies to every lane.
+    *  Both outputs carry the same lanes, their mono buffers the sum.
+    * 
+    **************************************************************************************************************************/
+    void VCA::voices(const int n, const int w) noexcept
+    {
+        const Ramp<float>& amp = rcv[ctl::amp];
+        const Lanes<float>& in = *ilv[cvi::amp];
+        float x[settings::poly], gain[settings::poly];
+
+        for(int s = 0; s < n; ++s)
         {
-            v = ccv[ctl::amp]->load() * sigmoid_amp(icv[cvi::amp]->load());
+            std::fill_n(x, w, 0.0f);
+            for(const int i: { cvi::a, cvi::b })
+            {
+                const Lanes<float>& lanes = *ilv[i];
+                if(lanes.width > 0) for(int l = 0; l < lanes.width; ++l) x[l] += lanes.data[s][l];
+                else x[0] += icv[i][s];
+            }
+
+            if(icv[cvi::amp] == ground) std::fill_n(gain, w, amp[s]);
+            else if(in.width == 0) std::fill_n(gain, w, amp[s] * sigmoid_amp(icv[cvi::amp][s]));
+            else 
+            {
+                for(int l = 0; l < in.width; ++l) gain[l] = amp[s] * sigmoid_amp(in.data[s][l]);
+                std::fill(gain + in.width, gain + w, amp[s] * sigmoid_amp(0.0f));
+            }
+
+            float sum = 0.0f;
+            for(int l = 0; l < w; ++l)
+            {
+                bus[s][l] = x[l] * gain[l];
+                sum += bus[s][l];
+            }
+            ocv[cvo::a][s] = sum;
+            ocv[cvo::b][s] = sum;
         }
-        float o = (icv[cvi::a]->load() + icv[cvi::b]->load()) * v; 
-        ocv[cvo::a].store(o);
-        ocv[cvo::b].store(o);
-    };
+    }
+
+    bool VCA::idle() noexcept
+    {
+        return (*iqv[cvi::a] && *iqv[cvi::b]) || (rcv[ctl::amp].from == 0.0f && rcv[ctl::amp].to == 0.0f);
+    }
 
-    VCA::VCA(): id(idc++), Module(idc, &vca::descriptor[0])
+    VCA::VCA(const int p, Arena& arena): Module(p, &vca::descriptor[0], arena), id(p)
     {  
+        olv[cvo::a].data = bus;
+        olv[cvo::b].data = bus;
     };
 }
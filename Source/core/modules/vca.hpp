@@ -24,15 +24,17 @@
 
 namespace core
 {
-    class VCA: public Module<float>
+    class VCA final: public Module<float>
     {
         private:
-            static int idc;
+            float bus[settings::block][settings::poly];     // Lanes of both outputs
+            void voices(const int, const int) noexcept;     // One gain per lane
 
         public:
             const int id;
-            void process() noexcept override;
-            VCA();
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Silent inputs or closed
+            VCA(const int, Arena&);
            ~VCA() = default;
     };
 }
@@ -23,70 +23,79 @@
 #include "vcd.hpp"
 #include "node.hpp"
 #include "vcd_interface.hpp"
+#include <algorithm>
 
 namespace core 
 {
     using namespace vcd;
-    int VCD::idc = 0;
 
-    VCD::VCD(): id(idc++), Module(idc, &vcd::descriptor)
+    VCD::VCD(const int p, Arena& arena): Module(p, &vcd::descriptor, arena), id(p)
     {
         reset();
     }
 
     void VCD::reset() 
     {
-        psf.reset(10.0f);
+        psf.reset(10.0f, rate);
         apf.a   = 0.6f;
-        length  = settings::sample_rate/4;
+        length  = rate/4;
         tmax    = length/2;
         eax     = 0.0f;
         departed  = 0;
+        hush      = length;
         data = std::make_unique<float[]>(length);
         for (uint i = 0; i < length; i++)  data.get()[i] = 0.0f;
-
-        for(int i = 0; i < cc; ++i) ccv[i] = &zero;
-        for(int i = 0; i < ic; ++i) icv[i] = &zero;
-        for(int i = 0; i < oc; ++i) ocv[i].store(0.0f);
     }
 
     VCD::~VCD() {}
 
-    void VCD::process() noexcept
+    bool VCD::idle() noexcept
     {
-        if (departed >= length) departed = 0;
-        float time = icv[cvi::time]->load() + ccv[ctl::time]->load();
+        return *iqv[cvi::a] && *iqv[cvi::b] && *iqv[cvi::c] && *iqv[cvi::d] && hush >= length;
+    }
+
+    void VCD::process(const int n) noexcept
+    {
+        const Ramp<float>& ctime = rcv[ctl::time];
+        const Ramp<float>& cfeed = rcv[ctl::feed];
+
+        for(int s = 0; s < n; ++s)
+        {
+            if (departed >= length) departed = 0;
+            float time = icv[cvi::time][s] + ctime[s];
 
-        if      (time > 1.0f) time = 1.0f;
-        else if (time < 0.1f) time = 0.1f;
+            if      (time > 1.0f) time = 1.0f;
+            else if (time < 0.1f) time = 0.1f;
 
 
-        time = psf.process(time);
-        
+            time = psf.process(time);
+            
 
-        float input = icv[cvi::a]->load()  +
-                      icv[cvi::b]->load()  +
-                      icv[cvi::c]->load()  +
-                      icv[cvi::d]->load();
+            float input = icv[cvi::a][s]  +
+                          icv[cvi::b][s]  +
+                          icv[cvi::c][s]  +
+                          icv[cvi::d][s];
 
 
-        int f = departed - roundf(fabsf(time) * tmax);
-        if (f < 0) f += length;
+            int f = departed - roundf(fabsf(time) * tmax);
+            if (f < 0) f += length;
 
-        float feedback = icv[cvi::feed]->load() + ccv[ctl::feed]->load();
-        if      (feedback > 1.0f) feedback = 1.0f;
-        else if (feedback < 0.0f) feedback = 0.0f;
+            float feedback = icv[cvi::feed][s] + cfeed[s];
+            if      (feedback > 1.0f) feedback = 1.0f;
+            else if (feedback < 0.0f) feedback = 0.0f;
 
-        float accu = data[departed] = input + (data[f] * feedback);
+            float accu = data[departed] = input + (data[f] * feedback);
 
-        apf.a = fabsf(eax - time);
-        accu = apf.process(accu);
-        eax = time;
-        departed++;
+            apf.a = fabsf(eax - time);
+            accu = apf.process(accu);
+            eax = time;
+            hush = fabsf(data[departed]) < settings::tail ? std::min(hush + 1, length) : 0;
+            departed++;
 
-        ocv[cvo::a].store(accu);
-        ocv[cvo::b].store(accu);
-        ocv[cvo::c].store(accu);
-        ocv[cvo::d].store(accu);
+            ocv[cvo::a][s] = accu;
+            ocv[cvo::b][s] = accu;
+            ocv[cvo::c][s] = accu;
+            ocv[cvo::d][s] = accu;
+        }
     }
 };
@@ -26,10 +26,9 @@
 
 namespace core {
 
-    class VCD: public Module<float>
+    class VCD final: public Module<float>
     {
         private:
-            static int idc;
             OnePole psf;
             AllPass apf;
             std::unique_ptr<float[]> data;
@@ -37,12 +36,14 @@ namespace core {
             float eax;
             int   length;
             int   departed;
+            int   hush;                                 // Samples written below settings::tail in a row
 
         public:
             const int id;
-            void process() noexcept override;
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Silent inputs, buffer drained
             void reset();
-            VCD();
+            VCD(const int, Arena&);
            ~VCD();
     };
 
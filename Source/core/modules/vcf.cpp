@@ -24,53 +24,233 @@
 #include "vcf.hpp"
 #include "node.hpp"
 #include "vcf_interface.hpp"
+#include "iospecs.hpp"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 namespace core 
 {
     using namespace vcf;
-    int VCF::idc = 0;
 
-    VCF::VCF(): id(idc++), Module(idc, &vcf::descriptor)
+    VCF::VCF(const int p, Arena& arena): Module(p, &vcf::descriptor, arena), id(p)
     { 
-        for(int i = 0; i < ic; ++i) icv[i] = &zero;
-        for(int i = 0; i < cc; ++i) ccv[i] = &zero;
         reset(); 
+        draw(rate);
+        for(int o = 0; o < 3; ++o) olv[o].data = bus[o];
     }
 
     void VCF::reset()
     {
         iceq[0]  = 0.0f;
         iceq[1]  = 0.0f;
+        std::fill_n(lane[0], 2 * settings::poly, 0.0f);
 
         g = 0.0f;
         k = 0.0f;
         a = 0.0f;
         b = 0.0f;
+        held[0] = -1.0f;
     }
 
-    void VCF::process() noexcept
+    bool VCF::idle() noexcept
     {
-        float cutoff = ccv[ctl::cutoff]->load() + icv[cvi::cutoff]->load();
-        if      (cutoff < 0.0f) cutoff = 0.0f;
-        else if (cutoff > 1.0f) cutoff = 1.0f;
+        if(!*iqv[cvi::a] || !*iqv[cvi::b] || !*iqv[cvi::c]) return false;
+        if(fabsf(iceq[0]) + fabsf(iceq[1]) > settings::tail) return false;
+        for(int l = 0; l < settings::poly; ++l) if(fabsf(lane[0][l]) + fabsf(lane[1][l]) > settings::tail) return false;
+        iceq[0] = 0.0f;                                 // Flush the residue
+        iceq[1] = 0.0f;
+        std::fill_n(lane[0], 2 * settings::poly, 0.0f);
+        return true;
+    }
+
+   /**************************************************************************************************************************
+    * 
+    *  g is tan(pi fc / fs) at the host rate, warped to the same fc when the engine is oversampled.
+    *  The cutoff knob bends fc with a fifth power: g is read from a table over the knob, drawn by Rack::clock
+    *  whenever the rates move, with the warp already in it.
+    * 
+    **************************************************************************************************************************/
+    void VCF::draw(const unsigned host) noexcept
+    {
+        const double warp = static_cast<double>(host) / rate;
+        for(int i = 0; i <= points; ++i)
+        {
+            const double c = static_cast<double>(i) / points;
+            const double gi = c * c * c * c * c * 0.6 + 0.01;
+            curve[i] = static_cast<float>(warp < 1.0 ? std::tan(std::atan(gi) * warp) : gi);
+        }
+        held[0] = -1.0f;
+    }
+
+    VCF::Coefficients VCF::coefficients(const float cutoff, const float Q) const noexcept
+    {
+        const float x = std::clamp(cutoff, 0.0f, 1.0f) * points;
+        const int i = std::min(static_cast<int>(x), points - 1);
+        const float gc = curve[i] + (x - i) * (curve[i + 1] - curve[i]);
+        const float q = std::clamp(Q, 0.0f, 1.0f);
+        const float kc = (1.0f - q * q * 0.9f) + 0.01f;
+        return { gc, kc, 1.0f / (1.0f + gc * (gc + kc)) };
+    }
+
+   /**************************************************************************************************************************
+    * 
+    *  Coefficients are worked out at control rate, then ramped across the frames in between: every stride frames when
+    *  cutoff or Q is patched, once per block when only the knobs move. With both still and unpatched they are kept
+    *  from one block to the next.
+    * 
+    **************************************************************************************************************************/
+    void VCF::process(const int n) noexcept
+    {
+        int width = 0;
+        for(const int i: { cvi::a, cvi::b, cvi::c, cvi::cutoff, cvi::Q }) width = std::max(width, ilv[i]->width);
+        for(int o = 0; o < 3; ++o) olv[o].width = width;
+        if(width > 0) return voices(n, width);
+
+        const Ramp<float>& ccutoff = rcv[ctl::cutoff];
+        const Ramp<float>& cQ      = rcv[ctl::Q];
+        const bool patched = icv[cvi::cutoff] != ground || icv[cvi::Q] != ground;
 
-        float Q = ccv[ctl::Q]->load() + icv[ctl::Q]->load();
-        if      (Q < 0.0f) Q = 0.0f;
-        else if (Q > 1.0f) Q = 1.0f;
+        if(!patched && ccutoff.step == 0.0f && cQ.step == 0.0f)
+        {
+            if(held[0] != ccutoff.to || held[1] != cQ.to)
+            {
+                const Coefficients c = coefficients(ccutoff.to, cQ.to);
+                g = c.g;
+                k = c.k;
+                a = c.a;
+                b = g * a;
+                held[0] = ccutoff.to;
+                held[1] = cQ.to;
+            }
+            for(int s = 0; s < n; ++s)
+            {
+                const float is = icv[cvi::a][s] + icv[cvi::b][s] + icv[cvi::c][s];
+                const float va = a * iceq[0] + b * (is - iceq[1]);
+                const float vb = iceq[1] + g * va;
+                iceq[0] = 2.0f * va - iceq[0];
+                iceq[1] = 2.0f * vb - iceq[1];
 
-        g = powf(cutoff, 5) * 0.6f + 0.01f;
-        k = (1.0f - Q * Q * 0.9f) + 0.01f;
-        a = 1.0f / (1.0f + g * (g + k));
+                ocv[cvo::lp][s] = vb;
+                ocv[cvo::bp][s] = va;
+                ocv[cvo::hp][s] = is - k * va - vb;
+            }
+            return;
+        }
+
+        held[0] = -1.0f;
+        auto at = [&](const int s) { return coefficients(ccutoff[s] + icv[cvi::cutoff][s], cQ[s] + icv[cvi::Q][s]); };
+        const int span = patched ? stride : n;
+        Coefficients c = at(0);
+        for(int first = 0; first < n; first += span)
+        {
+            const int e = std::min(span, n - first);
+            const Coefficients next = at(std::min(first + e, n - 1));
+            const float r = 1.0f / e;
+            const Coefficients d { (next.g - c.g) * r, (next.k - c.k) * r, (next.a - c.a) * r };
+
+            for(int s = first; s < first + e; ++s)
+            {
+                const float is = icv[cvi::a][s] + icv[cvi::b][s] + icv[cvi::c][s];
+                const float va = c.a * iceq[0] + c.g * c.a * (is - iceq[1]);
+                const float vb = iceq[1] + c.g * va;
+                iceq[0] = 2.0f * va - iceq[0];
+                iceq[1] = 2.0f * vb - iceq[1];
+
+                ocv[cvo::lp][s] = vb;
+                ocv[cvo::bp][s] = va;
+                ocv[cvo::hp][s] = is - c.k * va - vb;
+                c = { c.g + d.g, c.k + d.k, c.a + d.a };
+            }
+            c = next;
+        }
+        g = c.g;
+        k = c.k;
+        a = c.a;
         b = g * a;
+    }
+
+   /**************************************************************************************************************************
+    * 
+    *  Polyphonic cable on any input: w lanes side by side, each sample runs across the lanes.
+    *  Mono audio enters lane 0, the monophonic voice, mono cutoff and Q apply to every lane.
+    *  The mono outputs carry the sum of the lanes. Coefficients are ramped per lane as in process().
+    * 
+    **************************************************************************************************************************/
+    void VCF::voices(const int n, const int w) noexcept
+    {
+        const Ramp<float>& ccutoff = rcv[ctl::cutoff];
+        const Ramp<float>& cQ      = rcv[ctl::Q];
+        const bool patched = icv[cvi::cutoff] != ground || icv[cvi::Q] != ground;
+        float x[settings::poly], cutoff[settings::poly], Q[settings::poly];
+        float cg[settings::poly], ck[settings::poly], ca[settings::poly];     // Coefficients of the frame
+        float ng[settings::poly], nk[settings::poly], na[settings::poly];     // at the end of the span
+        float dg[settings::poly], dk[settings::poly], da[settings::poly];     // per frame
+
+        auto at = [&](const int s, float* G, float* K, float* A)
+        {
+            spread(cutoff, *ilv[cvi::cutoff], icv[cvi::cutoff], s, w);
+            spread(Q,      *ilv[cvi::Q],      icv[cvi::Q],      s, w);
+            for(int l = 0; l < w; ++l)
+            {
+                const Coefficients c = coefficients(ccutoff[s] + cutoff[l], cQ[s] + Q[l]);
+                G[l] = c.g;
+                K[l] = c.k;
+                A[l] = c.a;
+            }
+        };
+
+        const int span = patched ? stride : n;
+        at(0, cg, ck, ca);
+        for(int first = 0; first < n; first += span)
+        {
+            const int e = std::min(span, n - first);
+            at(std::min(first + e, n - 1), ng, nk, na);
+            const float r = 1.0f / e;
+            for(int l = 0; l < w; ++l)
+            {
+                dg[l] = (ng[l] - cg[l]) * r;
+                dk[l] = (nk[l] - ck[l]) * r;
+                da[l] = (na[l] - ca[l]) * r;
+            }
+
+            for(int s = first; s < first + e; ++s)
+            {
+                std::fill_n(x, w, 0.0f);
+                for(const int i: { cvi::a, cvi::b, cvi::c })
+                {
+                    const Lanes<float>& in = *ilv[i];
+                    if(in.width > 0) for(int l = 0; l < in.width; ++l) x[l] += in.data[s][l];
+                    else x[0] += icv[i][s];
+                }
+
+                float* lp = bus[cvo::lp][s];
+                float* bp = bus[cvo::bp][s];
+                float* hp = bus[cvo::hp][s];
+                for(int l = 0; l < w; ++l)
+                {
+                    const float va = ca[l] * lane[0][l] + cg[l] * ca[l] * (x[l] - lane[1][l]);
+                    const float vb = lane[1][l] + cg[l] * va;
+                    lane[0][l] = 2.0f * va - lane[0][l];
+                    lane[1][l] = 2.0f * vb - lane[1][l];
 
-        float is = icv[cvi::a]->load() + icv[cvi::b]->load() + icv[cvi::c]->load();
-        float va = a * iceq[0] + b * (is - iceq[1]);
-        float vb = iceq[1] + g * va;
-        iceq[0]  = 2.0f * va - iceq[0];
-        iceq[1]  = 2.0f * vb - iceq[1];
+                    lp[l] = vb;
+                    bp[l] = va;
+                    hp[l] = x[l] - ck[l] * va - vb;
+                    cg[l] += dg[l];
+                    ck[l] += dk[l];
+                    ca[l] += da[l];
+                }
 
-        ocv[cvo::lp].store(vb);
-        ocv[cvo::bp].store(va);
-        ocv[cvo::hp].store(is - k * va - vb);
+                for(int o = 0; o < 3; ++o)
+                {
+                    float sum = 0.0f;
+                    for(int l = 0; l < w; ++l) sum += bus[o][s][l];
+                    ocv[o][s] = sum;
+                }
+            }
+            std::copy_n(ng, w, cg);
+            std::copy_n(nk, w, ck);
+            std::copy_n(na, w, ca);
+        }
     }
 };
@@ -26,21 +26,33 @@
 
 namespace core {
 
-    class VCF: public Module<float>
+    class VCF final: public Module<float>
     {
         private:
-            static int idc;
             float iceq[2];
+            float lane[2][settings::poly];              // State per voice
+            float bus[3][settings::block][settings::poly];  // lp, bp, hp lanes
             float g;
             float k;
             float a;
             float b;
 
+            static constexpr int points = 256;          // Cutoff table intervals
+            static constexpr int stride = 8;            // Frames between coefficients under CV
+            float curve[points + 1];                    // Cutoff -> g, at the engine rate
+            float held[2];                              // Cutoff and Q of g, k, a, b
+            struct Coefficients { float g, k, a; };
+            Coefficients coefficients(const float, const float) const noexcept;    // Cutoff and Q, clamped
+
+            void voices(const int, const int) noexcept; // One filter per lane
+
         public:
             const int id;
-            void process() noexcept override;
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // Silent inputs, state decayed
+            void draw(const unsigned) noexcept;         // curve at the engine rate, warped from the host rate
             void reset();
-            VCF();
+            VCF(const int, Arena&);
            ~VCF() = default;
     };
 };
@@ -25,144 +25,237 @@
 #include "utility.hpp"
 
 #include "iospecs.hpp"
-#include "scales.h"
 #include "vco_interface.hpp"
 #include <iostream>
 
 namespace core
 {
     using namespace vco;
-    int VCO::idc = 0;
 
-    inline float getFrequency(int n) 
+    inline float cube(const float x) 
     {
-        constexpr float A4 = 440.0f;
-        return A4 * std::pow(2.0f, n / 12.0f);
+        return x * x * x;
     }
 
-    void VCO::set_delta(const unsigned& voice)
+   /**************************************************************************************************************************
+    * 
+    *  Pitch of a voice, looked up again only when its key or the engine rate moves.
+    *  Detune, control and CV, stays out of the cache: the kernel adds fine * span to base at every sample.
+    * 
+    **************************************************************************************************************************/
+    const VCO::Pitch& VCO::tune(const int voice) noexcept
     { 
-        int n = note[voice] + 12 * ccv[ctl::octave]->load();
+        Pitch& p = pitch[voice];
+        const int key = note[voice] + static_cast<int>(12 * rcv[ctl::octave].to);
+        if(key == p.key && p.rate == rate) return p;
 
-        if(n < chroma_n)[[likely]]
-        {
-            freq[voice]  = chromatic[n];
-            delta[voice] = chromatic[n] * tao / settings::sample_rate; 
-        }
-        else[[unlikely]] 
-        {
-            auto f = getFrequency(n);
-            freq[voice]  = f;
-            delta[voice] = f * tao / settings::sample_rate;
-        }
-        set_fine(voice);
+        p.key  = key;
+        p.rate = rate;
+        freq[voice] = (*tuning)[key];
+        p.base = freq[voice] * tao / rate;
+        p.span = p.base * (chromatic_ratio - 1.0 / chromatic_ratio) * 2.0;
+        return p;
     }
 
-    void VCO::set_fine(const unsigned& voice)
+    void VCO::retune(const Tuning& t) noexcept
     {
-        float range   = (freq[voice] * chromatic_ratio - freq[voice] / chromatic_ratio) * tao / settings::sample_rate;
-        delta[voice] += (ccv[ctl::detune]->load() + icv[cvi::detune]->load() - 0.5f) * range * 2.0f;
+        tuning = &t;
+        for(Pitch& p: pitch) p.key = -1;
     }
 
-    inline float VCO::tomisawa(const int& voice)
+   /**************************************************************************************************************************
+    * 
+    *  Voice kernel
+    *  One lane per voice: phase, increment and mip level are loaded once, advanced over the block, then written back.
+    *  Lanes past the last voice repeat the first one, muted.
+    *  Forms are read from band-limited tables, the mip level follows the phase increment at the start of the block.
+    *  Tomisawa: the feedback oscillator at steady state, minus itself shifted by pw.
+    *  Pulse and hexagon: drawn across pw, see draw below.
+    *  PLL: fPLL() is the phase error wrapped to one turn, computed here without complex exponentials.
+    * 
+    **************************************************************************************************************************/
+    template <int F>
+    void VCO::kernel(const int* id, const int count, const int n, const Frames& f, float* out, const bool poly, const bool enveloped) noexcept
     {
-        float oa = cosf(phase[voice] + mem[0][voice]);
-        mem[0][voice] = (oa + mem[0][voice]) * 0.5f;
+        using namespace simd;
+        const Wavetable& wave = table[F];
+        const float* single = wave.cut(0.0f).slice;
 
-        float pw =  icv[cvi::pwm] == &zero ? 
-            (0.5f - ccv[ctl::pwm]->load()) * tao * 0.98f - pi :
-            (0.5f - ccv[ctl::pwm]->load() + icv[cvi::pwm]->load());  
+        for(int g = 0; g < count; g += width)
+        {
+            alignas(32) float p[width], base[width], span[width], live[width], length[width];
+            alignas(32) int offset[width], lane[width];
+            const int used = std::min(width, count - g);
+            for(int k = 0; k < width; ++k)
+            {
+                lane[k] = id[g + (k < used ? k : 0)];
+                const Pitch& pt = tune(lane[k]);
+                base[k] = pt.base;
+                span[k] = pt.span;
+                const int m = Wavetable::level(base[k] + f.fine[0] * span[k]);
+                p[k]      = phase[lane[k]];
+                live[k]   = k < used ? 1.0f : 0.0f;
+                offset[k] = wave.offset(m);
+                length[k] = Wavetable::size(m);
+            }
 
-        float ob = cosf(phase[voice] + mem[1][voice] + pw);
-        mem[1][voice] = (ob + mem[1][voice]) * 0.5f;
-        return oa - ob;
-    }
+            const vf b = load(base), d = load(span), on = load(live), size = load(length);
+            const vi at = load(offset), who = load(lane);
+            vf ph = load(p);
 
-    inline float VCO::pulse(const int& voice)
-    {
-        float pw =  icv[cvi::pwm] == &zero ? 
-            (0.5f - ccv[ctl::pwm]->load()) * 2.0f :
-            (0.5f - ccv[ctl::pwm]->load() + icv[cvi::pwm]->load()) * 2.0f;    
+            for(int s = 0; s < n; ++s)
+            {
+                ph = ph + (b + set(f.fine[s]) * d) + set(f.fm[s]);
+                ph = select(ph >= set(pi), ph - set(tao), ph);
 
-        return fPulse(phase[voice], pw, 0.0001f);
-    }
+                vf y;
+                if constexpr(F == 0)
+                {
+                    y = Wavetable::read(single, at, size, ph) - Wavetable::read(single, at, size, ph + set(f.pw[s]));
+                }
+                else
+                {
+                    const Wavetable::Cut c = wave.cut(f.pw[s]);
+                    const vf a = Wavetable::read(c.slice, at, size, ph);
+                    y = a + set(c.mix) * (Wavetable::read(c.next, at, size, ph) - a);
+                }
 
-    inline float VCO::hexagon(const int& voice)
-    {
-        float pw = icv[cvi::pwm] == &zero ? 
-            (0.5f - ccv[ctl::pwm]->load()) * pi :
-            (0.5f - ccv[ctl::pwm]->load() + icv[cvi::pwm]->load()) * pi;
+                if(f.lock)
+                {
+                    vf e = (y - set(f.pll[s])) * set(1.0f / tao);
+                    e = e - floor(e + set(0.5f));
+                    ph = ph + e * set(tao * f.pull[s]);
+                }
+
+                y = y * set(f.gain[s]) * (enveloped ? simd::gather(pin[s], who) * on : on);
+                if(poly)
+                {
+                    alignas(32) float v[width];
+                    store(v, y);
+                    for(int k = 0; k < used; ++k) lanes[s][lane[k]] = v[k];
+                }
+                out[s] += sum(y);
+            }
 
-            float feed = (fTriangle(phase[voice], 0.001f) * fSquare(phase[voice] + pw, 0.001f))/pi + (pi * 0.5f - fabsf(pw)) * 0.25f;
-        return feed * (pi - fabsf(pw));
+            store(p, ph);
+            for(int k = 0; k < used; ++k) phase[lane[k]] = p[k];
+        }
     }
 
-    void VCO::process() noexcept
+    namespace draw
     {
-        if(mode() == Poly)
+        void tomisawa(double* cycle, const int n, const double)
         {
-            float accu = 0.0;
-            float fm  = powf(ccv[ctl::fm]->load(),  3.0f) * icv[cvi::fm]->load();
-            float pll = powf(ccv[ctl::pll]->load(), 3.0f);
-
-            for(int i = 1; i < settings::poly; ++i)
+            double mem = 0.0;
+            for(int c = 0; c < 4; ++c)                  // Let the feedback settle
             {
-                if(gate[i])
+                for(int i = 0; i < n; ++i)
                 {
-                    set_delta(i);
-                    phase[i] += (delta[i] + fm);
-                    if(phase[i] >= pi) phase[i] -= tao;  
-
-                    auto current = (this->*form[(int)ccv[ctl::form]->load()])(i);
-
-                    if(icv[cvi::pll] != &zero)
-                    {
-                        phase[i] += fPLL(current, icv[cvi::pll]->load()) * pll;
-                    }
-                    if(icv[cvi::am] != &zero)
-                    {
-                        current = xfade(current * icv[cvi::am]->load(), current, ccv[ctl::am]->load());
-                    }
-                    current *= ccv[ctl::amp]->load();
-                    current *= *pin[i];
-                    accu    += current;
-                                    
+                    cycle[i] = std::cos(-pi + tao * i / n + mem);
+                    mem = (cycle[i] + mem) * 0.5;
                 }
             }
-            ocv[cvo::main].store(accu);
+        }
 
+        void pulse(double* cycle, const int n, const double w)
+        {
+            for(int i = 0; i < n; ++i) cycle[i] = fPulse(-pi + tao * i / n, w, 0.0001f);
         }
-        
-        else 
+
+        void hexagon(double* cycle, const int n, const double w)
         {
-            if(gate[Mono])
+            const float pw = w * pi * 0.5;
+            for(int i = 0; i < n; ++i)
             {
-                set_delta(Mono);
+                const float x = -pi + tao * i / n;
+                const float feed = (fTriangle(x, 0.001f) * fSquare(x + pw, 0.001f)) / pi + (pi * 0.5f - fabsf(pw)) * 0.25f;
+                cycle[i] = feed * (pi - fabsf(pw));
+            }
+        }
+    }
 
-                float fm = powf(ccv[ctl::fm]->load(), 3.0f);
+    const Wavetable* VCO::bank()
+    {
+        static const Wavetable tables[3] { { &draw::tomisawa }, { &draw::pulse, 65 }, { &draw::hexagon, 65 } };
+        return tables;
+    }
 
-                phase[Mono] += (delta[Mono] + icv[cvi::fm]->load() * fm);
-                if(phase[Mono] >= pi) phase[Mono] -= tao;  
+    void VCO::process(const int n) noexcept
+    {
+        for(int k = 0; k < settings::shards; ++k) render(n, k);
+        gather(n);
+    }
 
-                float accu = (this->*form[(int)ccv[ctl::form]->load()])(Mono);
+    void VCO::gather(const int n) noexcept
+    {
+        float* out = ocv[cvo::main];
+        std::copy_n(part[0], n, out);
+        for(int k = 1; k < settings::shards; ++k)
+        {
+            for(int s = 0; s < n; ++s) out[s] += part[k][s];
+        }
 
-                if(icv[cvi::pll] != &zero)
-                {
-                    float f = powf(ccv[ctl::pll]->load(), 3.0f);
-                    phase[Mono] += fPLL(accu, icv[cvi::pll]->load()) * f;
-                }
-                if(icv[cvi::am] != &zero)
-                {
-                    accu = xfade(accu * icv[cvi::am]->load(), accu, ccv[ctl::am]->load());
-                }
-                accu *= ccv[ctl::amp]->load();
-                if(mode() == Mono) accu *= *pin[Mono];
-                ocv[cvo::main].store(accu);
+        const int width = mode() == Poly ? voices->lanes : 0;       // Voices left out this block are silent lanes
+        for(int v = 0; v < width; ++v)
+        {
+            if(v != Mono && gate[v]) continue;
+            for(int s = 0; s < n; ++s) lanes[s][v] = 0.0f;
+        }
+        olv[cvo::main].width = width;
+    }
+
+    bool VCO::idle() noexcept
+    {
+        if(mode() != Poly) return !gate[Mono];
+        for(int i = 0; i < voices->count; ++i) if(gate[voices->list[i]]) return false;
+        return true;
+    }
+
+    void VCO::render(const int n, const int shard) noexcept
+    {
+        const int form = static_cast<int>(rcv[ctl::form].to);
+        const Ramp<float>& amp = rcv[ctl::amp];
+        const Ramp<float>& am  = rcv[ctl::am];
+        const Ramp<float>& fm  = rcv[ctl::fm];
+        const Ramp<float>& pll = rcv[ctl::pll];
+        const Ramp<float>& pwm = rcv[ctl::pwm];
+        const bool patched = icv[cvi::pwm] != ground;
+        float* out = part[shard];
+
+        std::fill_n(out, n, 0.0f);
+
+        int id[settings::poly], count = 0;
+        const bool poly = mode() == Poly;
+        if(poly)
+        {
+            for(int j = voices->first(shard); j < voices->last(shard); ++j)
+            {
+                if(gate[voices->list[j]]) id[count++] = voices->list[j];
             }
-            else ocv[cvo::main].store(0.0f);
         }
+        else if(shard == 0 && gate[Mono]) id[count++] = Mono;
+        if(count == 0) return;
 
+        Frames f;
+        f.lock = icv[cvi::pll] != ground;
+        for(int s = 0; s < n; ++s)
+        {
+            f.fine[s] = rcv[ctl::detune][s] + icv[cvi::detune][s] - 0.5f;
+            f.fm[s]   = cube(fm[s]) * icv[cvi::fm][s];
+            f.gain[s] = icv[cvi::am] != ground ? xfade(icv[cvi::am][s], 1.0f, am[s]) * amp[s] : amp[s];
+            f.pll[s]  = icv[cvi::pll][s];
+            f.pull[s] = cube(pll[s]);
+            const float shape = patched ? 0.5f - pwm[s] + icv[cvi::pwm][s] : 0.5f - pwm[s];
+            f.pw[s]   = form == 0 ? (patched ? shape : shape * tao * 0.98f - pi) : shape * 2.0f;
+        }
 
+        const bool enveloped = poly || mode() == Mono;
+        switch(form)
+        {
+            case 0:  kernel<0>(id, count, n, f, out, poly, enveloped); break;
+            case 1:  kernel<1>(id, count, n, f, out, poly, enveloped); break;
+            default: kernel<2>(id, count, n, f, out, poly, enveloped); break;
+        }
     }
 
     VCO::Mode VCO::mode() const noexcept
@@ -175,18 +268,15 @@ namespace core
         for(int i = 0; i < settings::poly; ++i)
         {
             phase[i]    = 0;
-            delta[i]    = 0;
-            mem[0][i]   = 0.0f;
-            mem[1][i]   = 0.0f;
-            mem[2][i]   = 0.0f;
             note[i]     = 36;
             gate[i]     = false;
         }
     }
 
-    VCO::VCO(): id(idc++), Module(idc, &vco::descriptor)
+    VCO::VCO(const int p, Arena& arena): Module(p, &vco::descriptor, arena), table(bank()), tuning(&Tuning::equal()), id(p)
     {
         reset();
+        olv[cvo::main].data = lanes;
     }
 
     VCO::~VCO() = default;
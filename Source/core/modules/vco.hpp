@@ -22,56 +22,71 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <complex>
-#include <set>
 #include "node.hpp"
+#include "voices.hpp"
+#include "utility/wavetable.hpp"
+#include "setup/tuning.hpp"
 
 namespace core
 {
-    namespace settings
-    {
-        const int poly { 32 };
-    }
-
     /**************************************************************************************************************************
     * 
     *  VCO
     * 
     **************************************************************************************************************************/
-    class VCO: public Module<float>
+    class VCO final: public Module<float>
     {   
         private:
             float phase[settings::poly];                // Current phase
-            float delta[settings::poly];                // Phase increment
-            float mem[3][settings::poly];               // Feedback memory
-            float tomisawa(const int&);
-            float pulse(const int&);
-            float hexagon(const int&);
-            float (VCO::*form[3])(const int&) = 
-            { 
-                &VCO::tomisawa, 
-                &VCO::pulse, 
-                &VCO::hexagon 
+            float part[settings::shards][settings::block];  // Per shard sums
+            float lanes[settings::block][settings::poly];   // Voices of the polyphonic output
+            const Wavetable* table;                     // One per form, shared by every VCO
+            static const Wavetable* bank();
+
+            struct Frames                               // Per frame values shared by every voice of a block
+            {
+                float fine[settings::block];            // Detune, -0.5 to 0.5
+                float fm[settings::block];              // Phase offset
+                float pw[settings::block];              // Form shape
+                float gain[settings::block];            // Amp and AM
+                float pll[settings::block];             // PLL reference
+                float pull[settings::block];            // PLL strength
+                bool  lock;                             // PLL patched
+            };
+            struct Pitch                                // Kept per voice until its key or the engine rate changes
+            {
+                int key = -1;
+                unsigned rate = 0;
+                float base;                             // Phase increment at the centre of the detune range
+                float span;                             // Phase increment across the detune range
             };
-            static int idc;                             // ID counter
+            Pitch pitch[settings::poly];
+            const Tuning* tuning;
+            const Pitch& tune(const int) noexcept;
+            template <int F>                            // Form F over a list of voices, simd::width at a time
+            void kernel(const int*, const int, const int, const Frames&, float*, const bool, const bool) noexcept;
   
         public:
             enum Mode { Mono, Freerun, Poly };
             Mode mode() const noexcept;
-            const float* pin[settings::poly];
+            const float (*pin)[settings::poly] = nullptr;   // Envelope levels [settings::block]
             int id;                                     // Unique VCO id
             float freq[settings::poly];                 // Frequency
             uint8_t note[settings::poly];               // Triggered note
             bool gate[settings::poly];
-            std::set<int> active{}; 
-            void process() noexcept override;
-            void set_delta(const unsigned&);
-            void set_fine(const unsigned&);
+            const Voices* voices = nullptr;             // Sounding voices, set by Spiro
+            void process(const int) noexcept override;
+            bool idle() noexcept;                       // No gate open
+            void render(const int, const int) noexcept;     // Voices of one shard
+            void gather(const int) noexcept;                // Sum of the shards
             
+            void retune(const Tuning&) noexcept;        // Not while processing
             void reset();
-            VCO();
+            VCO(const int, Arena&);
            ~VCO();
     };
 
@@ -0,0 +1,139 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "pool.hpp"
+#include "utility/rtcheck.hpp"
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace core
+{
+    static inline void relax() noexcept
+    {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__) && defined(__GNUC__)
+        asm volatile("yield");
+#endif
+    }
+
+    static void promote(std::thread& t) noexcept        // Raise, silently kept as is if refused. Placement is left to the OS
+    {
+#if defined(__linux__)
+        sched_param param {};
+        param.sched_priority = sched_get_priority_max(SCHED_FIFO) - 1;
+        pthread_setschedparam(t.native_handle(), SCHED_FIFO, &param);
+#else
+        (void)t;
+#endif
+    }
+
+    void Pool::enqueue(const int self, const int t) noexcept
+    {
+        for(int k = schedule->task[t].shards - 1; k >= 0; --k) ready[self].push(t * settings::shards + k);
+    }
+
+    bool Pool::execute(const int self) noexcept
+    {
+        int e;
+        bool found = ready[self].pop(e);
+        for(int i = 1; !found && i <= helpers; ++i) found = ready[(self + i) % (helpers + 1)].steal(e);
+        if(!found) return false;
+
+        const int t = e / settings::shards, k = e % settings::shards;
+        const Task& task = schedule->task[t];
+        if(task.shards > 1)
+        {
+            for(int i = task.first; i < task.first + task.count; ++i) rack.render(schedule->run[i], frames, k);
+            if(left[t].fetch_sub(1, std::memory_order_acq_rel) > 1) return true;
+            for(int i = task.first; i < task.first + task.count; ++i) rack.gather(schedule->run[i], frames);
+        }
+        else for(int i = task.first; i < task.first + task.count; ++i) rack.process(schedule->run[i], frames);
+
+        for(int i = 0; i < task.outputs; ++i)
+        {
+            const int next = task.next[i];
+            if(pending[next].fetch_sub(1, std::memory_order_acq_rel) == 1) enqueue(self, next);
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    void Pool::process(const Schedule& s, const int n) noexcept
+    {
+        schedule = &s;
+        frames   = n;
+        for(int t = 0; t < s.tasks; ++t) 
+        {
+            pending[t].store(s.task[t].inputs, std::memory_order_relaxed);
+            left[t].store(s.task[t].shards, std::memory_order_relaxed);
+        }
+        remaining.store(s.tasks, std::memory_order_release);
+        for(int t = 0; t < s.tasks; ++t) if(s.task[t].inputs == 0) enqueue(0, t);
+
+        generation.fetch_add(1, std::memory_order_release);
+        generation.notify_all();
+
+        while(remaining.load(std::memory_order_acquire) > 0) if(!execute(0)) relax();
+    }
+
+    void Pool::work(const int self) noexcept
+    {
+        unsigned seen = generation.load(std::memory_order_acquire);
+        while(true)
+        {
+            for(int spin = 0; generation.load(std::memory_order_acquire) == seen; ++spin)
+            {
+                if(spin < 4096) relax(); else generation.wait(seen, std::memory_order_acquire);
+            }
+            seen = generation.load(std::memory_order_acquire);
+            if(!running.load(std::memory_order_acquire)) return;
+
+            rt::Scope audio;
+            while(remaining.load(std::memory_order_acquire) > 0) if(!execute(self)) relax();
+        }
+    }
+
+    Pool::Pool(Rack& rack, const int helpers): rack(rack), helpers(helpers)
+    {
+        ready  = std::make_unique<queue[]>(helpers + 1);
+        thread = std::make_unique<std::thread[]>(helpers);
+        for(int i = 0; i < helpers; ++i)
+        {
+            thread[i] = std::thread(&Pool::work, this, i + 1);
+            promote(thread[i]);
+        }
+    }
+
+    Pool::~Pool()
+    {
+        running.store(false, std::memory_order_release);
+        generation.fetch_add(1, std::memory_order_release);
+        generation.notify_all();
+        for(int i = 0; i < helpers; ++i) thread[i].join();
+    }
+}
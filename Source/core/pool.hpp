@@ -0,0 +1,71 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include "rack.hpp"
+#include "schedule.hpp"
+#include "utility/wsdeque.hpp"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace core
+{
+   /**********************************************************************************************************************
+    * 
+    *  Pool
+    *  Runs the tasks of a schedule on helper threads and the calling thread.
+    *  Tasks become ready when the tasks feeding them are done, idle threads steal ready tasks
+    *  from the others. process() returns once the whole block is rendered.
+    *  A sharded task is queued once per voice shard, the last shard to finish gathers.
+    *  Helpers run at real-time priority on whichever cores the OS gives them: none are pinned, so engines
+    *  of several plugin instances do not pile onto the same cores. Only engines made parallel have a pool.
+    *
+    **********************************************************************************************************************/
+    class Pool
+    {
+        private:
+            using queue = wsdeque<int, 128>;                    // Entries: task * shards + shard
+            static_assert(settings::sectors * settings::shards <= 128, "A block can hold more shards than a queue");
+
+            Rack& rack;
+            std::unique_ptr<queue[]> ready;                     // Per thread, 0: caller
+            std::unique_ptr<std::thread[]> thread;
+            std::atomic<int> pending[settings::sectors];        // Inputs left per task
+            std::atomic<int> left[settings::sectors];           // Shards left per task
+            alignas(64) std::atomic<int> remaining = 0;         // Tasks left in the block
+            alignas(64) std::atomic<unsigned> generation = 0;   // Bumped every block
+            std::atomic<bool> running = true;
+            const Schedule* schedule = nullptr;
+            int frames = 0;
+
+            void enqueue(const int, const int) noexcept;        // Push every shard of a task
+            bool execute(const int) noexcept;                   // Run one ready shard, false when none
+            void work(const int) noexcept;                      // Helper thread body
+
+        public:
+            const int helpers;
+            void process(const Schedule&, const int) noexcept;
+            Pool(Rack&, const int);
+           ~Pool();
+    };
+}
@@ -1,5 +1,7 @@
 #include "rack.hpp"
 #include "modules/interface/descriptor.hxx"
+#include "setup/iospecs.hpp"
+#include <cmath>
 #include <cstdint>
 #include <locale>
 
@@ -22,23 +24,115 @@ namespace core
         return indexMap.find(uid)->second;
     }
 
-    void Rack::process(const int& p) noexcept 
+    template <int S>
+    void Rack::run(const int n) noexcept
+    {
+        auto& module = get<S>();
+        if constexpr(Sleeper<std::remove_reference_t<decltype(module)>>)
+        {
+            if(module.idle()) return module.sleep();
+            module.wake();
+        }
+        module.process(n);
+    }
+
+    template <int... S>
+    void Rack::dispatch(const int p, const int n, std::integer_sequence<int, S...>) noexcept
+    {
+        (void)((p == S && (run<S>(n), true)) || ...);
+    }
+
+    template <int... S>
+    void Rack::dispatch(const int p, const int n, const int shard, std::integer_sequence<int, S...>) noexcept
+    {
+        auto render = [this]<int I>(const int n, const int shard) 
+        {
+            auto& module = get<I>();
+            using type = std::remove_reference_t<decltype(module)>;
+            if constexpr(Voiced<type>) 
+            {
+                if constexpr(Sleeper<type>) if(module.idle()) return;
+                module.render(n, shard);
+            }
+            else if(shard == 0) run<I>(n);
+        };
+        (void)((p == S && (render.template operator()<S>(n, shard), true)) || ...);
+    }
+
+    template <int... S>
+    void Rack::collect(const int p, const int n, std::integer_sequence<int, S...>) noexcept
+    {
+        auto gather = [this]<int I>(const int n) 
+        {
+            auto& module = get<I>();
+            using type = std::remove_reference_t<decltype(module)>;
+            if constexpr(Voiced<type>) 
+            {
+                if constexpr(Sleeper<type>) 
+                {
+                    if(module.idle()) return module.sleep();
+                    module.wake();
+                }
+                module.gather(n);
+            }
+        };
+        (void)((p == S && (gather.template operator()<S>(n), true)) || ...);
+    }
+
+    void Rack::snapshot(const int n) noexcept
+    {
+        const float k = 1.0f - std::exp(-n / (settings::glide * rate));
+        for(auto* module: node) module->snapshot(n, k);
+    }
+
+    void Rack::process(const int& p, const int n) noexcept 
+    { 
+        dispatch(p, n, std::make_integer_sequence<int, settings::sectors>());
+    }
+
+    void Rack::render(const int& p, const int n, const int shard) noexcept 
     { 
-        node[p]->process(); 
+        dispatch(p, n, shard, std::make_integer_sequence<int, settings::sectors>());
     }
 
-    Rack::Rack(const Grid* grid): grid(grid)
+    void Rack::gather(const int& p, const int n) noexcept 
+    { 
+        collect(p, n, std::make_integer_sequence<int, settings::sectors>());
+    }
+
+    bool Rack::voiced(const int& p) noexcept
+    {
+        return [this, p]<int... S>(std::integer_sequence<int, S...>) 
+        { 
+            return ((p == S && Voiced<std::remove_reference_t<decltype(get<S>())>>) || ...); 
+        }(std::make_integer_sequence<int, settings::sectors>());
+    }
+
+    void Rack::clock(const unsigned host, const unsigned engine)
+    {
+        rate = engine;
+        for(auto* module: node) module->rate = engine;
+        for(auto& delay: static_cast<Shelf<mt::vcd>&>(shelves).item) delay.reset();     // Delay lines are sized in frames
+        for(auto& filter: static_cast<Shelf<mt::vcf>&>(shelves).item) filter.draw(host);
+    }
+
+    static_assert(settings::hot() <= 32 * 1024, "Port buffers no longer fit a typical L1 data cache");
+
+    Rack::Footprint Rack::footprint() const noexcept
+    {
+        return { sizeof(Shelves), arena.hot.footprint(), arena.cold.footprint() };
+    }
+
+    Rack::Rack(const Grid* grid): grid(grid), arena(memory, settings::hot(), settings::cold()), shelves(arena)
     { 
         std::cout<<"Rack::Rack()\n"; 
-        node = new Module<float>*[grid->sectors]; 
-        std::cout<<"-- Space for rack allocated...\n";
-        for(int i = 0; i < grid->sectors; ++i)
-        {
-            node[i] = create_node(grid->sector[i].descriptor->type);
-        }
+        [this]<int... S>(std::integer_sequence<int, S...>) 
+        { 
+            ((node[S] = &get<S>()), ...); 
+        }(std::make_integer_sequence<int, settings::sectors>());
         calculateModuleMap();
         calculateIndexMap();
-        std::cout<<"-- Rack built...\n";
+        std::cout<<"-- Rack built, "<<footprint().state<<" bytes state, "<<footprint().hot<<" hot, "<<footprint().cold<<" cold...\n";
     }
 
     void Rack::calculateModuleMap()
@@ -60,33 +154,8 @@ namespace core
         }
     }
 
-    Module<float>* Rack::create_node(const map::module::type& t)
-    {
-        switch (t)
-        {
-            case map::module::type::env: return new ENV(); break;
-            case map::module::type::lfo: return new LFO(); break;
-            case map::module::type::cso: return new CSO(); break;
-            case map::module::type::mix: return new MIX(); break;
-            case map::module::type::pdt: return new PDT(); break;
-            case map::module::type::rtr: return new RTR(); break;
-            case map::module::type::snh: return new SNH(); break;
-            case map::module::type::sum: return new SUM(); break;
-            case map::module::type::vca: return new VCA(); break;
-            case map::module::type::vcd: return new VCD(); break;
-            case map::module::type::vcf: return new VCF(); break;
-            case map::module::type::vco: return new VCO(); break;
-            case map::module::type::cro: return new CRO(); break;
-            case map::module::type::com: return new COM(); break;
-            default: break;
-        }
-        return nullptr;
-    }
-   
     Rack::~Rack()
     { 
         std::cout<<"Rack::~Rack()\n";
-        for(int i = 0; i < grid->sectors; ++i) delete node[i]; 
-        delete[] node;
     }
 }
@@ -2,27 +2,162 @@
 #include "grid.hpp"
 #include "module_headers.hpp"
 #include "modules/node.hpp"
+#include "utility/arena.hpp"
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <unordered_map>
+#include <utility>
 
 namespace core
 {
+    namespace settings
+    {
+        constexpr int population(const map::module::type t)        // Instances of a module type
+        {
+            int n = 0;
+            for(const auto& sector: sector_map) n += sector.descriptor->type == t;
+            return n;
+        }
+
+        constexpr int slot(const int s)                             // Position of a sector among its type
+        {
+            int n = 0;
+            for(int i = 0; i < s; ++i) n += sector_map[i].descriptor->type == sector_map[s].descriptor->type;
+            return n;
+        }
+
+        constexpr std::size_t hot()                                 // Input pointers, output buffers and ramps
+        {
+            std::size_t n = 0;
+            for(const auto& sector: sector_map)
+            {
+                n += align(*sector.descriptor->cv[map::cv::i] * sizeof(const float*));
+                n += align(*sector.descriptor->cv[map::cv::o] * sizeof(float) * block);
+                n += align(*sector.descriptor->cv[map::cv::c] * sizeof(Ramp<float>));
+            }
+            return n;
+        }
+
+        constexpr std::size_t cold()                                // Control pointers, output tables, silence flags and lanes
+        {
+            std::size_t n = 0;
+            for(const auto& sector: sector_map)
+            {
+                n += align(*sector.descriptor->cv[map::cv::c] * sizeof(std::atomic<float>*));
+                n += align(*sector.descriptor->cv[map::cv::o] * sizeof(float*));
+                n += align(*sector.descriptor->cv[map::cv::i] * sizeof(const bool*));
+                n += align(*sector.descriptor->cv[map::cv::o] * sizeof(bool));
+                n += align(*sector.descriptor->cv[map::cv::i] * sizeof(const Lanes<float>*));
+                n += align(*sector.descriptor->cv[map::cv::o] * sizeof(Lanes<float>));
+            }
+            return n;
+        }
+    }
+
+    template <typename X>
+    concept Voiced = requires(X& x) { x.render(0, 0); x.gather(0); };
+
+    template <typename X>
+    concept Sleeper = requires(X& x) { { x.idle() } -> std::same_as<bool>; };
+
+    template <map::module::type> struct model;
+    template <> struct model<map::module::type::vco> { using type = VCO; };
+    template <> struct model<map::module::type::lfo> { using type = LFO; };
+    template <> struct model<map::module::type::cso> { using type = CSO; };
+    template <> struct model<map::module::type::vca> { using type = VCA; };
+    template <> struct model<map::module::type::vcd> { using type = VCD; };
+    template <> struct model<map::module::type::vcf> { using type = VCF; };
+    template <> struct model<map::module::type::snh> { using type = SNH; };
+    template <> struct model<map::module::type::sum> { using type = SUM; };
+    template <> struct model<map::module::type::pdt> { using type = PDT; };
+    template <> struct model<map::module::type::rtr> { using type = RTR; };
+    template <> struct model<map::module::type::mix> { using type = MIX; };
+    template <> struct model<map::module::type::env> { using type = ENV; };
+    template <> struct model<map::module::type::com> { using type = COM; };
+    template <> struct model<map::module::type::cro> { using type = CRO; };
+
+   /**********************************************************************************************************************
+    *
+    *  Shelf
+    *  Every instance of one module type, in sector order.
+    *
+    **********************************************************************************************************************/
+    template <map::module::type T>
+    struct Shelf
+    {
+        using type = typename model<T>::type;
+
+        template <int... P>
+        static std::array<type, sizeof...(P)> make(Arena& arena, std::integer_sequence<int, P...>) { return { type(P, arena)... }; }
+
+        std::array<type, settings::population(T)> item;
+        Shelf(Arena& arena): item(make(arena, std::make_integer_sequence<int, settings::population(T)>())) {}
+    };
+
+   /**********************************************************************************************************************
+    *
+    *  Rack
+    *  Modules are laid out from settings::sector_map at compile time,
+    *  process() reaches them through direct calls on their concrete type.
+    *  Their ports live in one cache aligned block owned by the rack.
+    *  Modules reporting idle() are put to sleep: outputs zeroed once and flagged silent,
+    *  so that the modules they feed can fall asleep in turn.
+    *
+    **********************************************************************************************************************/
     class Rack
     {
         private:
+            using mt = map::module::type;
+            struct Shelves: Shelf<mt::vco>, Shelf<mt::lfo>, Shelf<mt::cso>, Shelf<mt::vca>, Shelf<mt::vcd>,
+                            Shelf<mt::vcf>, Shelf<mt::snh>, Shelf<mt::sum>, Shelf<mt::pdt>, Shelf<mt::rtr>,
+                            Shelf<mt::mix>, Shelf<mt::env>, Shelf<mt::com>, Shelf<mt::cro> 
+            {
+                Shelves(Arena& a): Shelf<mt::vco>(a), Shelf<mt::lfo>(a), Shelf<mt::cso>(a), Shelf<mt::vca>(a), Shelf<mt::vcd>(a),
+                                   Shelf<mt::vcf>(a), Shelf<mt::snh>(a), Shelf<mt::sum>(a), Shelf<mt::pdt>(a), Shelf<mt::rtr>(a),
+                                   Shelf<mt::mix>(a), Shelf<mt::env>(a), Shelf<mt::com>(a), Shelf<mt::cro>(a) {}
+            };
+
             const Grid* const grid;
+            alignas(cacheline) std::byte memory[settings::hot() + settings::cold()];
+            Arena arena;                                            // Hot region first, cold after
+            Shelves shelves;
+            Module<float>* node[settings::sectors];                 // Rack index -> module
+            unsigned rate = settings::rate;                         // Engine frames per second
             std::unordered_map<uint16_t, Module<float>*> moduleMap;
             std::unordered_map<uint16_t, int> indexMap;
             void calculateModuleMap();
             void calculateIndexMap();
-            Module<float>** node;
-            Module<float>* create_node(const map::module::type&);
+
+            template <int S>
+            auto& get() noexcept
+            {
+                return static_cast<Shelf<settings::sector_map[S].descriptor->type>&>(shelves).item[settings::slot(S)];
+            }
+
+            template <int S>
+            void run(const int) noexcept;                           // Process, or sleep while idle
+            template <int... S>
+            void dispatch(const int, const int, std::integer_sequence<int, S...>) noexcept;
+            template <int... S>
+            void dispatch(const int, const int, const int, std::integer_sequence<int, S...>) noexcept;
+            template <int... S>
+            void collect(const int, const int, std::integer_sequence<int, S...>) noexcept;
 
         public:
+            struct Footprint { std::size_t state, hot, cold; };
+            Footprint footprint() const noexcept;                   // Bytes per engine
             Module<float>* at(const map::module::type&, const int&) const noexcept;
             Module<float>* at(const int&) const noexcept;
             int index(uint8_t, uint8_t) const noexcept;
-            void process(const int&) noexcept;
+            void snapshot(const int) noexcept;                          // Controls of every module, once per block
+            void process(const int&, const int) noexcept;
+            void render(const int&, const int, const int) noexcept;    // One voice shard, whole module if not voiced
+            void gather(const int&, const int) noexcept;                // Close a sharded block
+            bool voiced(const int&) noexcept;                           // Renders by voice shards
+            void clock(const unsigned, const unsigned);                 // Host and engine rates. Not while processing
             Rack(const Grid*);
            ~Rack();
     };
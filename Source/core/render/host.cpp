@@ -0,0 +1,119 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "host.hpp"
+#include "grid.hpp"
+#include "iospecs.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+namespace core
+{
+    static const Control::type controls[] { Control::slider, Control::parameter };
+
+    // Value of attribute key in the tag starting at from, empty when missing
+    static std::string attribute(const std::string& xml, const std::size_t from, const std::string& key)
+    {
+        const std::size_t end = xml.find('>', from);
+        const std::size_t at  = xml.find(" " + key + "=\"", from);
+        if(at == std::string::npos || at > end) return {};
+        const std::size_t first = at + key.size() + 3;
+        return xml.substr(first, xml.find('"', first) - first);
+    }
+
+    Host::Host(const unsigned rate, const int block, const int threads)
+    {
+        settings::buffer_size = block;
+        spiro = std::make_unique<Spiro>(&grid);
+        spiro->oversample(rate, 1, Decimator::quality::standard);
+
+        control = std::make_unique<std::atomic<float>[]>(grid.count(Control::slider) + grid.count(Control::parameter));
+        int k = 0;
+        for(const auto type: controls)
+        {
+            for(int i = 0; i < grid.count(type); ++i, ++k)
+            {
+                const auto uid = grid.getUID(i, type);
+                control[k].store(grid.control(uid)->def);
+                spiro->rack.at(static_cast<map::module::type>(uid.mt), uid.mp)->ccv[uid.pp] = &control[k];
+            }
+        }
+
+        const int inputs  = grid.count(Control::input);
+        const int outputs = grid.count(Control::output);
+        bay = std::make_unique<Patchbay>(inputs, outputs, inputs, outputs);
+        spiro->bay = bay.get();
+        spiro->compile(true);
+        spiro->parallel(threads);
+    }
+
+    void Host::patch(const uint32_t output, const uint32_t input)
+    {
+        bay->matrix.set(grid.getIndex(input), grid.getIndex(output), true);
+        spiro->connect(output, input);
+    }
+
+   /**********************************************************************************************************************
+    * 
+    *  The state is an APVTS tree, <PARAM id="..." value="..."/> per parameter, matrix cells as "mm<input * outputs + output>".
+    *  Binary state (copyXmlToBinary) starts with an 8 byte header before the XML text.
+    *
+    **********************************************************************************************************************/
+    bool Host::load(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if(!file) return false;
+        std::string xml { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        if(xml.size() > 8 && std::memcmp(xml.data(), "VC2!", 4) == 0) xml.erase(0, 8);
+        if(xml.find("<PARAM") == std::string::npos) return false;
+
+        std::unordered_map<std::string, float> value;
+        for(std::size_t at = xml.find("<PARAM"); at != std::string::npos; at = xml.find("<PARAM", at + 1))
+        {
+            const std::string id = attribute(xml, at, "id");
+            const std::string v  = attribute(xml, at, "value");
+            if(!id.empty() && !v.empty()) value[id] = std::strtof(v.c_str(), nullptr);
+        }
+
+        int k = 0;
+        for(const auto type: controls)
+        {
+            for(int i = 0; i < grid.count(type); ++i, ++k)
+            {
+                const auto found = value.find(grid.name(grid.getUID(i, type), true));
+                if(found != value.end()) control[k].store(found->second);
+            }
+        }
+
+        const int outputs = grid.count(Control::output);
+        for(int i = 0; i < grid.count(Control::input) * outputs; ++i)
+        {
+            const auto found = value.find("mm" + std::to_string(i));
+            bay->matrix.set(i / outputs, i % outputs, found != value.end() && found->second > 0.5f);
+        }
+        spiro->compile(true);
+        return true;
+    }
+}
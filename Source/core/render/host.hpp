@@ -0,0 +1,53 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include "spiro.hpp"
+#include "modmatrix.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace core
+{
+   /**********************************************************************************************************************
+    * 
+    *  Host
+    *  Stands in for the plugin: owns the control values and the patch bay of one engine,
+    *  and loads presets written by Processor::getStateInformation.
+    *
+    **********************************************************************************************************************/
+    class Host
+    {
+        private:
+            std::unique_ptr<std::atomic<float>[]> control;      // Sliders then parameters, in grid order
+            std::unique_ptr<Patchbay> bay;
+
+        public:
+            std::unique_ptr<Spiro> spiro;
+            bool load(const std::string&);                      // Preset file, false when unreadable
+            void patch(const uint32_t, const uint32_t);         // Output id, input id
+            Host(const unsigned, const int, const int);         // Sample rate, host block, helper threads
+           ~Host() = default;
+    };
+}
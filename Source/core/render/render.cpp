@@ -0,0 +1,139 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "host.hpp"
+#include "smf.hpp"
+#include "wav.hpp"
+#include "constants.hpp"
+#include "rtcheck.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*****************************************************************************************************************************
+* 
+*  spiro_render [options] <preset> <midi> <wav>
+*  Renders a MIDI file through a preset as fast as the CPU allows, no host or GUI involved.
+* 
+*****************************************************************************************************************************/
+static int usage()
+{
+    std::fprintf(stderr,
+        "usage: spiro_render [options] <preset> <midi> <wav>\n"
+        "  -r <hz>       sample rate            (48000)\n"
+        "  -b <frames>   host block size        (512)\n"
+        "  -t <threads>  helper threads, 0: off (0)\n"
+        "  -l <seconds>  tail after last event  (2)\n"
+        "  -o <factor>   oversampling 1/2/4/8   (1)\n"
+        "  -q <preset>   decimator 0 eco, 1 standard, 2 high (1)\n");
+    return 2;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned rate  = 48000;
+    int block      = 512;
+    int threads    = 0;
+    double tail    = 2.0;
+    int factor     = 1;
+    int quality    = 1;
+    std::vector<std::string> files;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        if(a.size() == 2 && a[0] == '-')
+        {
+            if(++i >= argc) return usage();
+            switch(a[1])
+            {
+                case 'r': rate    = std::strtoul(argv[i], nullptr, 10); break;
+                case 'b': block   = std::atoi(argv[i]);                 break;
+                case 't': threads = std::atoi(argv[i]);                 break;
+                case 'l': tail    = std::atof(argv[i]);                 break;
+                case 'o': factor  = std::atoi(argv[i]);                 break;
+                case 'q': quality = std::atoi(argv[i]);                 break;
+                default : return usage();
+            }
+        }
+        else files.push_back(a);
+    }
+    if(files.size() != 3 || rate == 0 || block <= 0 || threads < 0 || tail < 0.0 || factor < 1 || quality < 0 || quality > 2) return usage();
+
+    core::Host host(rate, block, threads);
+    host.spiro->oversample(rate, factor, static_cast<core::Decimator::quality>(quality));
+    if(!host.load(files[0]))
+    {
+        std::fprintf(stderr, "spiro_render: cannot read preset %s\n", files[0].c_str());
+        return 1;
+    }
+    std::vector<core::Event> events;
+    if(!core::smf(files[1], rate, events))
+    {
+        std::fprintf(stderr, "spiro_render: cannot read MIDI file %s\n", files[1].c_str());
+        return 1;
+    }
+    core::Wav wav(files[2], rate);
+    if(!wav.ok())
+    {
+        std::fprintf(stderr, "spiro_render: cannot write %s\n", files[2].c_str());
+        return 1;
+    }
+
+    const long length = (events.empty() ? 0 : events.back().offset) + static_cast<long>(tail * rate);
+    auto& spiro = *host.spiro;
+    std::vector<float> l(block), r(block);
+    std::vector<core::Event> due;
+    std::size_t next = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for(long frame = 0; frame < length; frame += block)
+    {
+        const int n = static_cast<int>(std::min<long>(block, length - frame));
+        due.clear();
+        for(; next < events.size() && events[next].offset < frame + n; ++next)
+        {
+            due.push_back(events[next]);
+            due.back().offset -= frame;
+        }
+        spiro.render(n, due.data(), static_cast<int>(due.size()), [&](const int offset, const int m)
+        {
+            for(int i = 0; i < m; ++i)
+            {
+                l[offset + i] = spiro.out[core::Spiro::stereo::l][i] * 0.2f;      // Same output gain as the plugin
+                r[offset + i] = spiro.out[core::Spiro::stereo::r][i] * 0.2f;
+            }
+        });
+        wav.write(l.data(), r.data(), n);
+    }
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const double audio = static_cast<double>(length) / rate;
+    std::fprintf(stderr, "spiro_render: %zu events, %.2f s rendered in %.3f s, %.1fx realtime, %u voices stolen\n",
+                 events.size(), audio, wall, wall > 0.0 ? audio / wall : 0.0, spiro.voices.steals.load());
+    std::fprintf(stderr, "spiro_render: %u voice gates opened, %u closed\n", spiro.opened.load(), spiro.closed.load());
+    if(core::rt::enabled) core::rt::report(std::cerr);
+    return 0;
+}
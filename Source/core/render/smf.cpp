@@ -0,0 +1,161 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "smf.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+
+namespace core
+{
+    struct Message
+    {
+        uint64_t tick;
+        int track;
+        int order;                                              // Position in its track
+        uint8_t status;
+        uint8_t msb;
+        uint8_t lsb;
+        uint32_t tempo;                                         // Microseconds per quarter, status 0xFF only
+    };
+
+    class Reader
+    {
+        private:
+            const std::vector<uint8_t>& data;
+            std::size_t at;
+            const std::size_t end;
+
+        public:
+            bool ok() const noexcept { return at <= end; }
+            std::size_t position() const noexcept { return at; }
+            bool done() const noexcept { return at >= end; }
+            uint8_t byte() noexcept { return at < end ? data[at++] : (at = end + 1, 0); }
+            uint8_t peek() const noexcept { return at < end ? data[at] : 0; }
+            void skip(const uint32_t n) noexcept { at = n <= end - std::min(at, end) ? at + n : end + 1; }
+            uint32_t word(const int n) noexcept                 // Big endian
+            {
+                uint32_t v = 0;
+                for(int i = 0; i < n; ++i) v = (v << 8) | byte();
+                return v;
+            }
+            uint32_t vlq() noexcept                             // Variable length quantity
+            {
+                uint32_t v = 0;
+                for(int i = 0; i < 4; ++i)
+                {
+                    const uint8_t b = byte();
+                    v = (v << 7) | (b & 0x7F);
+                    if(!(b & 0x80)) break;
+                }
+                return v;
+            }
+            Reader(const std::vector<uint8_t>& d, const std::size_t from, const std::size_t to): data(d), at(from), end(std::min(to, d.size())) {}
+    };
+
+    static bool track(Reader r, const int index, std::vector<Message>& out)
+    {
+        uint64_t tick = 0;
+        uint8_t running = 0;
+        int order = 0;
+        while(!r.done() && r.ok())
+        {
+            tick += r.vlq();
+            uint8_t status = r.peek();
+            if(status & 0x80) r.byte();
+            else if(running) status = running;                  // Running status
+            else return false;
+
+            if(status == 0xFF)                                  // Meta
+            {
+                const uint8_t type = r.byte();
+                const uint32_t length = r.vlq();
+                if(type == 0x51 && length == 3) out.push_back(Message { tick, index, order++, 0xFF, 0, 0, r.word(3) });
+                else if(type == 0x2F) break;                    // End of track
+                else r.skip(length);
+            }
+            else if(status == 0xF0 || status == 0xF7) r.skip(r.vlq());
+            else
+            {
+                running = status;
+                const uint8_t type = status & 0xF0;
+                const uint8_t msb  = r.byte() & 0x7F;
+                const uint8_t lsb  = (type == 0xC0 || type == 0xD0) ? 0 : r.byte() & 0x7F;
+                out.push_back(Message { tick, index, order++, status, msb, lsb, 0 });
+            }
+        }
+        return r.ok();
+    }
+
+    bool smf(const std::string& path, const unsigned rate, std::vector<Event>& events)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if(!file) return false;
+        const std::vector<uint8_t> data { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+        Reader header(data, 0, data.size());
+        if(header.word(4) != 0x4D546864) return false;          // MThd
+        const uint32_t length   = header.word(4);
+        header.word(2);                                         // Format, 0 and 1 read the same way
+        const int tracks        = header.word(2);
+        const uint16_t division = header.word(2);
+        header.skip(length - 6);
+        if(!header.ok()) return false;
+
+        std::vector<Message> messages;
+        for(int t = 0; t < tracks && !header.done(); ++t)
+        {
+            const uint32_t id   = header.word(4);
+            const uint32_t size = header.word(4);
+            if(!header.ok()) return false;
+            const Reader chunk(data, header.position(), header.position() + size);
+            header.skip(size);
+            if(id != 0x4D54726B) { --t; continue; }              // Not MTrk, skip unknown chunks
+            if(!track(chunk, t, messages)) return false;
+        }
+
+        std::stable_sort(messages.begin(), messages.end(), [](const Message& a, const Message& b)
+        {
+            return a.tick != b.tick ? a.tick < b.tick : a.track != b.track ? a.track < b.track : a.order < b.order;
+        });
+
+        double seconds = 0.0;
+        uint64_t last  = 0;
+        double tick    = (division & 0x8000) ?                  // Seconds per tick, SMPTE or 120 bpm until told otherwise
+            1.0 / (-static_cast<int8_t>(division >> 8) * (division & 0xFF)) :
+            0.5 / (division ? division : 480);
+        for(const auto& m: messages)
+        {
+            seconds += (m.tick - last) * tick;
+            last = m.tick;
+            if(m.status == 0xFF)
+            {
+                if(!(division & 0x8000)) tick = m.tempo * 1.0e-6 / (division ? division : 480);
+                continue;
+            }
+            events.push_back(Event { static_cast<int>(std::llround(seconds * rate)), m.status, m.msb, m.lsb });
+        }
+        return true;
+    }
+}
@@ -0,0 +1,68 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "wav.hpp"
+
+namespace core
+{
+    template <typename T>
+    static void put(std::ofstream& file, const T v) { file.write(reinterpret_cast<const char*>(&v), sizeof(T)); }
+
+    void Wav::header(const unsigned n)
+    {
+        const uint32_t bytes = n * 2 * sizeof(float);
+        file.write("RIFF", 4);
+        put<uint32_t>(file, 36 + bytes);
+        file.write("WAVEfmt ", 8);
+        put<uint32_t>(file, 16);
+        put<uint16_t>(file, 3);                                 // IEEE float
+        put<uint16_t>(file, 2);
+        put<uint32_t>(file, rate);
+        put<uint32_t>(file, rate * 2 * sizeof(float));
+        put<uint16_t>(file, 2 * sizeof(float));
+        put<uint16_t>(file, 32);
+        file.write("data", 4);
+        put<uint32_t>(file, bytes);
+    }
+
+    void Wav::write(const float* l, const float* r, const int n)
+    {
+        for(int i = 0; i < n; ++i)
+        {
+            put(file, l[i]);
+            put(file, r[i]);
+        }
+        frames += n;
+    }
+
+    Wav::Wav(const std::string& path, const unsigned rate): file(path, std::ios::binary), rate(rate)
+    {
+        if(file) header(0);
+    }
+
+    Wav::~Wav()
+    {
+        if(!file) return;
+        file.seekp(0);
+        header(frames);
+    }
+}
@@ -0,0 +1,51 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace core
+{
+   /**********************************************************************************************************************
+    * 
+    *  Wav
+    *  Stereo 32 bit float RIFF writer, sizes are patched in when the file is closed.
+    *  Little endian hosts only.
+    *
+    **********************************************************************************************************************/
+    class Wav
+    {
+        private:
+            std::ofstream file;
+            uint32_t frames = 0;
+            void header(const unsigned);
+
+        public:
+            const unsigned rate;
+            bool ok() const noexcept { return static_cast<bool>(file); }
+            void write(const float*, const float*, const int);
+            Wav(const std::string&, const unsigned);
+           ~Wav();
+    };
+}
@@ -0,0 +1,199 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+******************************************************************************************************************************/
+#include "schedule.hpp"
+
+namespace core
+{
+    /**************************************************************************************************************************
+     * edge[dst][src] : src output is patched into dst
+     * local[dst][src]: dst reads only the lanes src renders for the same voices, no sum
+     * active[node]   : node takes part in processing
+     * voiced[node]   : node can render its voices by shard
+     * ***********************************************************************************************************************/
+    void Schedule::compile(const bool (*edge)[settings::sectors], const bool (*local)[settings::sectors], const bool* active, const bool* voiced) noexcept
+    {
+        enum mark { fresh, open, done };
+        mark state[settings::sectors];
+        int  stack[settings::sectors];
+        int  next[settings::sectors];
+
+        for(int i = 0; i < settings::sectors; ++i) state[i] = fresh;
+        length   = 0;
+        feedback = 0;
+
+        for(int root = 0; root < settings::sectors; ++root)
+        {
+            if(!active[root] || state[root] != fresh) continue;
+
+            int depth = 0;
+            stack[depth] = root;
+            next[depth]  = 0;
+            state[root]  = open;
+
+            while(depth >= 0)
+            {
+                const int node = stack[depth];
+                int& src = next[depth];
+
+                while(src < settings::sectors && !(edge[node][src] && active[src])) ++src;
+
+                if(src < settings::sectors)
+                {
+                    const int s = src++;
+                    if     (state[s] == open)  ++feedback;          // Cycle: read last block
+                    else if(state[s] == fresh)
+                    {
+                        state[s] = open;
+                        ++depth;
+                        stack[depth] = s;
+                        next[depth]  = 0;
+                    }
+                }
+                else
+                {
+                    state[node] = done;
+                    order[length++] = node;
+                    --depth;
+                }
+            }
+        }
+        partition(edge, local, active, voiced);
+    }
+
+    void Schedule::partition(const bool (*edge)[settings::sectors], const bool (*local)[settings::sectors], const bool* active, const bool* voiced) noexcept
+    {
+        constexpr int N = settings::sectors;
+        int  group[N];
+        bool reach[N][N] {};
+        int  in[N] {};
+        int  out[N] {};
+
+        auto find = [&group](int i) { while(group[i] != i) i = group[i] = group[group[i]]; return i; };
+        auto join = [&group, &find](const int a, const int b) { group[find(a)] = find(b); };
+
+        for(int i = 0; i < N; ++i) group[i] = i;
+
+        // Condense: groups reaching each other form one cycle //////////////////////////////////////////////////////////////
+        for(int d = 0; d < N; ++d)
+        {
+            for(int s = 0; s < N; ++s)
+            {
+                if(edge[d][s] && active[d] && active[s]) reach[find(s)][find(d)] = true;
+            }
+        }
+        for(int k = 0; k < N; ++k)
+        {
+            for(int a = 0; a < N; ++a)
+            {
+                if(!reach[a][k]) continue;
+                for(int b = 0; b < N; ++b) reach[a][b] |= reach[k][b];
+            }
+        }
+        for(int a = 0; a < N; ++a)
+        {
+            for(int b = a + 1; b < N; ++b)
+            {
+                if(reach[a][b] && reach[b][a]) join(a, b);
+            }
+        }
+
+        // Voice shards: groups of voiced modules that do not feed each other through a sum ///////////////////////////////////
+        bool sound[N];
+        for(int i = 0; i < N; ++i) sound[i] = true;
+        for(int i = 0; i < N; ++i) if(active[i] && !voiced[i]) sound[find(i)] = false;
+        for(int d = 0; d < N; ++d)
+        {
+            for(int s = 0; s < N; ++s)
+            {
+                if(edge[d][s] && !local[d][s] && active[d] && active[s] && find(d) == find(s)) sound[find(d)] = false;
+            }
+        }
+
+        // Chains: a group fed by one group, itself feeding only that one, runs in the same task /////////////////////////////
+        // Voiced chains stay sharded when the feeder is read lane by lane: shard k renders its voices down the chain
+        bool link[N][N] {};
+        bool summed[N][N] {};
+        for(int d = 0; d < N; ++d)
+        {
+            for(int s = 0; s < N; ++s)
+            {
+                if(!edge[d][s] || !active[d] || !active[s]) continue;
+                const int a = find(s), b = find(d);
+                if(a != b && !local[d][s]) summed[a][b] = true;
+                if(a == b || link[a][b]) continue;
+                link[a][b] = true;
+                ++out[a];
+                ++in[b];
+            }
+        }
+        int feeder[N];
+        for(int a = 0; a < N; ++a)
+        {
+            for(int b = 0; b < N; ++b) if(link[a][b]) feeder[b] = a;
+        }
+        for(int b = 0; b < N; ++b)
+        {
+            if(in[b] != 1 || out[feeder[b]] != 1) continue;
+            const int a = feeder[b];
+            if(!sound[b] && !sound[a]) join(b, a);
+            else if(sound[b] && sound[a] && !summed[a][b]) join(b, a);
+        }
+
+        // Tasks, numbered by first appearance in the order ///////////////////////////////////////////////////////////////////
+        int id[N];
+        for(int i = 0; i < N; ++i) id[i] = -1;
+        tasks = 0;
+        for(int i = 0; i < length; ++i)
+        {
+            const int g = find(order[i]);
+            if(id[g] < 0) 
+            {
+                id[g] = tasks;
+                task[tasks++] = Task {};
+            }
+            ++task[id[g]].count;
+            if(sound[g]) task[id[g]].shards = settings::shards;
+        }
+        for(int t = 1; t < tasks; ++t) task[t].first = task[t - 1].first + task[t - 1].count;
+
+        int fill[N] {};
+        for(int i = 0; i < length; ++i)
+        {
+            const int t = id[find(order[i])];
+            run[task[t].first + fill[t]++] = order[i];
+        }
+
+        bool wait[N][N] {};
+        for(int d = 0; d < N; ++d)
+        {
+            for(int s = 0; s < N; ++s)
+            {
+                if(!edge[d][s] || !active[d] || !active[s]) continue;
+                const int a = id[find(s)], b = id[find(d)];
+                if(a == b || wait[a][b]) continue;
+                wait[a][b] = true;
+                task[a].next[task[a].outputs++] = b;
+                ++task[b].inputs;
+            }
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+******************************************************************************************************************************/
+#pragma once
+#include "grid.hpp"
+
+namespace core
+{
+   /**********************************************************************************************************************
+    * 
+    *  Schedule
+    *  Flat execution order of the rack, every module follows the modules feeding it.
+    *  Edges closing a cycle are read one block late.
+    *  The same order is cut into tasks for the parallel engine: cycles and chains
+    *  stay together, tasks only wait on the tasks feeding them.
+    *  Tasks made of voiced modules only are split again into voice shards, a voiced chain included
+    *  when each module reads only the lanes its feeder renders for the same voices.
+    *
+    **********************************************************************************************************************/
+    struct Wire
+    {
+        int module = -1;                                // Rack index, -1: unpatched
+        int port   = 0;
+    };
+
+    struct Patch
+    {
+        Wire sink;                                      // Module input
+        Wire source;                                    // Module output
+    };
+
+    struct Task
+    {
+        int first   = 0;                                // Into Schedule::run
+        int count   = 0;
+        int inputs  = 0;                                // Tasks to wait for
+        int outputs = 0;
+        int shards  = 1;                                // Voice ranges, > 1: every module renders by shard
+        int next[settings::sectors];                    // Tasks waiting for this one
+    };
+
+    struct Schedule
+    {
+        int order[settings::sectors];                   // Rack indices
+        int length   = 0;
+        int feedback = 0;                               // Edges delayed by one block
+        int run[settings::sectors];                     // Order regrouped by task
+        Task task[settings::sectors];
+        int tasks    = 0;
+        Wire wiring[settings::inputs];                  // Input socket -> source
+        unsigned resync = 0;                            // Bumped when wiring must be applied as a whole
+        void compile(const bool (*)[settings::sectors], const bool (*)[settings::sectors], const bool*, const bool*) noexcept;
+
+        private:
+            void partition(const bool (*)[settings::sectors], const bool (*)[settings::sectors], const bool*, const bool*) noexcept;
+    };
+}
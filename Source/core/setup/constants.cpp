@@ -4,5 +4,7 @@ namespace core {
 
 	std::atomic<float> zero = 0.0f;
     std::atomic<float> one  = 1.0f;
+    const float ground[settings::block] {};
+    const bool silent = true;
 
 };
@@ -5,16 +5,30 @@
 
 namespace core 
 {
+    namespace  settings
+    {
+        constexpr int scope_fps { 24 };
+        constexpr int block     { 64 };                 // Processing sub-block (frames)
+        constexpr int workers   { 0 };                  // Default helper threads of the parallel engine, 0: off
+        constexpr int grain     { 32 };                 // Shorter sub-blocks are rendered on one thread
+        constexpr int split     { 16 };                 // Shortest sub-block between two MIDI events
+        constexpr int poly      { 32 };                 // Voices, 0 is the monophonic one
+        constexpr int shards    { 4 };                  // Slices of the sounding voices rendered in parallel
+        constexpr float tail    { 1.0e-6f };            // State level under which a module counts as decayed
+        constexpr float glide   { 0.02f };              // Time constant of one-pole controls (s)
+        constexpr int oversampling { 1 };               // Default engine rate over host rate: 1, 2, 4 or 8
+        constexpr int quality   { 1 };                  // Default decimator preset: 0 eco, 1 standard, 2 high
+        constexpr unsigned rate { 48000 };              // Engine rate until the host sets one
+    }
+
     extern std::atomic<float> zero;
     extern std::atomic<float> one;
+    extern const float ground[settings::block];         // Unpatched input
+    extern const bool silent;                           // Silence flag of ground
     
     constexpr double pi                 = 3.14159265358979323846;
     constexpr double tao                = 6.28318530717958647692;
     constexpr double chromatic_ratio    = 1.05946309435929526456;
 
     const std::string lowercase { "abcdefghijklmnopqrstuvwxyz" };
-    namespace  settings
-    {
-        constexpr int scope_fps { 24 };
-    }
 }
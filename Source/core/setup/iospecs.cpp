@@ -4,7 +4,7 @@
 namespace core{
     namespace settings{
             unsigned buffer_size = 512;
-            unsigned sample_rate = 48000;
+            unsigned host_rate = 48000;
             unsigned channels = 2;
     }
 }
\ No newline at end of file
@@ -5,7 +5,7 @@ namespace core {
     namespace settings {
 
         extern unsigned buffer_size;
-        extern unsigned sample_rate;
+        extern unsigned host_rate;                      // Scope only, engines keep their own rate
         extern unsigned channels;
     }
 }
@@ -1,150 +0,0 @@
-
-#pragma once
-namespace core {
-constexpr float chromatic[] =
-{
-    8.17579891564370, // MIDI#0
-    8.66195721802725,
-    9.17702399741898,
-    9.72271824131502,
-    10.3008611535271,
-    10.9133822322813,
-    11.5623257097385,
-    12.2498573744296,
-    12.9782717993732,
-    13.75,
-    14.5676175474403,
-    15.4338531642538,
-    
-    16.3515978312874,
-    17.3239144360545,
-    18.3540479948379,
-    19.4454364826300,
-    20.6017223070543,
-    21.8267644645627,
-    23.1246514194771,
-    24.4997147488593,
-    25.9565435987465,
-    27.5,                 //A0
-    29.1352350948806,
-    30.8677063285077,
-
-    32.7031956625748,
-    34.6478288721090,
-    36.7080959896759,
-    38.8908729652601,
-    41.2034446141087,
-    43.6535289291254,
-    46.2493028389543,
-    48.9994294977186,
-    51.9130871974931,
-    55.0,                 //A1
-    58.2704701897612,
-    61.7354126570155,
-
-    65.4063913251496,
-    69.2956577442180,
-    73.4161919793519,
-    77.7817459305202,
-    82.4068892282174,
-    87.3070578582509,
-    92.4986056779086,
-    97.9988589954373,
-    103.826174394986,
-    110.0,                //A2
-    116.540940379522,
-    123.470825314031,
-
-    130.812782650299,
-    138.591315488436,
-    146.832383958703,
-    155.563491861040,
-    164.813778456434,
-    174.614115716501,
-    184.997211355817,
-    195.997717990874,
-    207.652348789972,
-    220.0,                //A3
-    233.081880759044,
-    246.941650628062,
-
-    261.625565300598,
-    277.182630976872,
-    293.664767917407,
-    311.126983722080,
-    329.627556912869,
-    349.228231433003,
-    369.994422711634,
-    391.995435981749,
-    415.304697579945,
-    440.0,                //A4 MIDI#69
-    466.163761518089,
-    493.883301256124,
-
-    523.251130601197,
-    554.365261953744,
-    587.329535834815,
-    622.253967444161,
-    659.255113825739,
-    698.456462866007,
-    739.988845423268,
-    783.990871963498,
-    830.609395159890,
-    880.0,
-    932.327523036179,
-    987.766602512248,
-
-    1046.50226120239,
-    1108.73052390748,
-    1174.65907166963,
-    1244.50793488832,
-    1318.51022765147,
-    1396.91292573201,
-    1479.97769084653,
-    1567.98174392699,
-    1661.21879031978,
-    1760.0,
-    1864.65504607235,
-    1975.53320502449,
-
-    2093.00452240478,
-    2217.46104781497,
-    2349.31814333926,
-    2489.01586977664,
-    2637.02045530295,
-    2793.82585146403,
-    2959.95538169307,
-    3135.96348785399,
-    3322.43758063956,
-    3520.0,
-    3729.31009214471,
-    3951.06641004899,
-
-    4186.00904480957,
-    4434.92209562995,
-    4698.63628667852,
-    4978.03173955329,
-    5274.04091060591,
-    5587.65170292806,
-    5919.91076338615,
-    6271.92697570798,
-    6644.87516127912,
-    7040.0,
-    7458.62018428943,
-    7902.13282009798,
-
-    8372.01808961915,
-    8869.84419125990,
-    9397.27257335704,
-    9956.06347910659,
-    10548.0818212118,
-    11175.3034058561,
-    11839.8215267723,
-    12543.8539514159,
-    13289.7503225582,
-    14080.0,
-    14917.2403685788,
-    15804.2656401959
-};
-constexpr int chroma_n = sizeof(chromatic)/sizeof(float);
-}
@@ -0,0 +1,46 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "tuning.hpp"
+#include <cmath>
+
+namespace core {
+
+    Tuning::Tuning(const double* cents, const int degrees, const int root, const double reference)
+    {
+        const double period = cents[degrees - 1];
+        for(int k = 0; k < keys; ++k)
+        {
+            const int d = k - root;
+            const int o = d >= 0 ? d / degrees : -((degrees - 1 - d) / degrees);    // Periods from the root, rounded down
+            const int i = d - o * degrees;                                          // Degree inside the period
+            hz[k] = static_cast<float>(reference * std::exp2((o * period + (i > 0 ? cents[i - 1] : 0.0)) / 1200.0));
+        }
+    }
+
+    const Tuning& Tuning::equal()
+    {
+        static constexpr double semitones[12] { 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200 };
+        static const Tuning tuning(semitones, 12);
+        return tuning;
+    }
+}
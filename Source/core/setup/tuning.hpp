@@ -0,0 +1,51 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include <algorithm>
+
+namespace core {
+
+   /***************************************************************************************************************************
+    * 
+    *  Tuning
+    *  Frequency of every key, from MIDI note 0 up to five octaves above the last note for the VCO octave control.
+    *  A scale is a list of degrees in cents above the root, its last entry the period, repeated up and down from the root
+    *  key sounding at the reference frequency. Scala files list their degrees the same way.
+    *  Keys are laid out once, reading one is a clamped index.
+    * 
+    **************************************************************************************************************************/
+    class Tuning
+    {
+        public:
+            static constexpr int keys = 128 + 12 * 5;
+
+        private:
+            float hz[keys];
+
+        public:
+            float operator[](const int key) const noexcept { return hz[std::clamp(key, 0, keys - 1)]; }
+
+            static const Tuning& equal();               // Twelve tone equal temperament, A4 at 440 Hz
+            Tuning(const double* cents, const int degrees, const int root = 69, const double reference = 440.0);
+    };
+}
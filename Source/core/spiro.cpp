@@ -25,80 +25,177 @@
 #include "modules/interface/descriptor.hxx"
 #include "modules/vco.hpp"
 #include "setup/midi.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
+#include <utility>
 
 
 namespace core
 {
-    void Spiro::process() noexcept
+    void Spiro::process(const int n) noexcept
     {
-        // for(int o = 0; o < grid->sectors; ++o) rack.process(o);
-        for(const auto o: whitelist) rack.process(o);
-        out[stereo::l].store(mixer->ocv[stereo::l].load());
-        out[stereo::r].store(mixer->ocv[stereo::r].load());
+        rt::Scope audio;
+        update();
+        consume();
+        voices.collect([this](const int v)
+        {
+            for(int i = 0; i < 4; ++i) if(envelope[i]->gate[v]) return false;
+            return true;
+        });
+        rack.snapshot(n);
+        if(pool && schedule->tasks > 1 && n >= settings::grain) [[likely]] pool->process(*schedule, n);
+        else for(int i = 0; i < schedule->length; ++i) rack.process(schedule->order[i], n);
+    }
+
+    void Spiro::step(const int n) noexcept
+    {
+        if(factor == 1) return process(n);
+        for(int done = 0; done < n;)
+        {
+            const int m = std::min(n - done, settings::block / factor);
+            process(m * factor);
+            down[stereo::l].process(mixer->ocv[stereo::l], decimated[stereo::l] + done, m);
+            down[stereo::r].process(mixer->ocv[stereo::r], decimated[stereo::r] + done, m);
+            done += m;
+        }
+    }
+
+    void Spiro::oversample(const unsigned host, const int f, const Decimator::quality q)
+    {
+        factor = f >= 8 ? 8 : f >= 4 ? 4 : f >= 2 ? 2 : 1;
+        rate   = host * factor;
+        for(auto& d: down) d.setup(factor, q);
+        rack.clock(host, rate);
+        out[stereo::l] = factor > 1 ? decimated[stereo::l] : mixer->ocv[stereo::l];
+        out[stereo::r] = factor > 1 ? decimated[stereo::r] : mixer->ocv[stereo::r];
+    }
+
+    int Spiro::latency() const noexcept
+    {
+        return down[stereo::l].latency();
+    }
+
+    void Spiro::parallel(const int workers)
+    {
+        const int helpers = std::min(workers, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+        if(helpers <= 0) pool.reset();
+        else if(!pool || pool->helpers != helpers) 
+        {
+            pool.reset();
+            pool = std::make_unique<Pool>(rack, helpers);
+        }
+    }
+
+    void Spiro::route(const Wire& to, const Wire& from) noexcept
+    {
+        auto* module = rack.at(to.module);
+        module->icv[to.port] = from.module < 0 ? ground  : rack.at(from.module)->ocv[from.port];
+        module->iqv[to.port] = from.module < 0 ? &silent : rack.at(from.module)->oqv + from.port;
+        module->ilv[to.port] = from.module < 0 ? &narrow : rack.at(from.module)->olv + from.port;
+    }
+
+    void Spiro::update() noexcept
+    {
+        Patch patch;
+        while(edits.pop(patch)) route(patch.sink, patch.source);
+
+        if(schedules.acquire())
+        {
+            schedule = &schedules.front();
+            if(schedule->resync != applied)     // Edits were dropped, rewire from the table
+            {
+                for(int i = 0; i < settings::inputs; ++i) route(sink[i], schedule->wiring[i]);
+                applied = schedule->resync;
+            }
+        }
     }
 
     Spiro::Spiro(const Grid* grid): grid(grid), rack(grid)
     {
         mixer = rack.at(map::module::type::mix, 0);
-        com   = rack.at(map::module::type::com, 0);
+        com   = dynamic_cast<COM*>(rack.at(map::module::type::com, 0));
         blacklist.emplace(rack.index(map::module::type::mix, 0));
-        whitelist.emplace(rack.index(map::module::type::mix, 0));
+        out[stereo::l] = mixer->ocv[stereo::l];
+        out[stereo::r] = mixer->ocv[stereo::r];
 
-        activeOutputs = new int[grid->sectors];
-        for(int i = 0; i < grid->sectors; ++i) activeOutputs[i] = 0;
+        schedule = &schedules.front();
+        source = std::make_unique<Wire[]>(settings::outputs);
+        sink   = std::make_unique<Wire[]>(settings::inputs);
+        for(int i = 0; i < settings::outputs; ++i)
+        {
+            auto uid  = grid->getUID(i, Control::output);
+            source[i] = Wire { rack.index(uid.mt, uid.mp), uid.pp };
+        }
+        for(int i = 0; i < settings::inputs; ++i)
+        {
+            auto uid = grid->getUID(i, Control::input);
+            sink[i]  = Wire { rack.index(uid.mt, uid.mp), uid.pp };
+        }
 
         for(int i = 0; i < 4; ++i) 
         {
             blacklist.emplace(rack.index(map::module::type::env, i));
-            whitelist.emplace(rack.index(map::module::type::env, i));
 
             envelope[i]   = dynamic_cast<ENV*>(rack.at(map::module::type::env, i));
             oscillator[i] = dynamic_cast<VCO*>(rack.at(map::module::type::vco, i));
             
-            envelope[i]->onStart = [=](int voice)
-            {
-                oscillator[i]->note[voice] = note[voice];
-                oscillator[i]->gate[voice] = true;
-                envelope[i]->gate[voice]   = true;
-                envelope[i]->hold[voice]   = true;
-                active.emplace(voice);
-            };
-
-            envelope[i]->onFinish = [=](int voice) 
-            {
-                oscillator[i]->gate[voice] = false;
-                envelope[i]->gate[voice]   = false;
-                active.erase(voice);
-            };
-
-            for(int voice = 0; voice < settings::poly; ++voice)
-            {
-                oscillator[i]->pin[voice] = &envelope[i]->pin[voice];
-            }
+            oscillator[i]->pin    = envelope[i]->pin;
+            oscillator[i]->voices = &voices;
+            envelope[i]->voices   = &voices;
+        }
+        for(int i = 0; i < settings::population(map::module::type::cso); ++i)
+        {
+            attractor[i] = dynamic_cast<CSO*>(rack.at(map::module::type::cso, i));
+            attractor[i]->voices = &voices;
         }
+        compile();
     }
 
-    Spiro::~Spiro()
+   /**********************************************************************************************************************
+    * 
+    *  Envelopes only flag their voices, starting on a note on, finishing at the end of their last stage.
+    *  The oscillators are gated here, before each pass: a voice finishing mid-pass is already silent, its
+    *  envelope lanes zeroed by the kernel from the frame it finished. The last event of a voice wins, which leaves
+    *  the gates as the envelopes ended. Envelopes share no state with Spiro then, each pair runs as one sharded task.
+    *
+    **********************************************************************************************************************/
+    void Spiro::consume() noexcept
     {
-        delete[] activeOutputs; 
+        for(int i = 0; i < 4; ++i)
+        {
+            for(int v = 0; v < settings::poly; ++v)
+            {
+                switch(std::exchange(envelope[i]->event[v], env::Event::None))
+                {
+                    case env::Event::Start:
+                        if(!oscillator[i]->gate[v]) opened.fetch_add(1, std::memory_order_relaxed);
+                        oscillator[i]->note[v] = note[v];
+                        oscillator[i]->gate[v] = true;
+                        break;
+                    case env::Event::Finish:
+                        if(oscillator[i]->gate[v]) closed.fetch_add(1, std::memory_order_relaxed);
+                        oscillator[i]->gate[v] = false;
+                        break;
+                    default: break;
+                }
+            }
+        }
     }
 
     void Spiro::noteOn(uint8_t msb, uint8_t lsb)
     {
-        if(++voiceIterator >= settings::poly) voiceIterator = 1;
-        for(auto voice: active) 
+        if(!voices.retrigger && voices.find(msb) >= 0) release(voices.find(msb));
+        const int voice = voices.allocate(msb, [this](const int v)
         {
-            if(note[voice] == msb) 
-            {
-                voiceIterator = voice;   // On duplicate
-                break;
-            }
-        }
+            float level = 0.0f;
+            for(int i = 0; i < 4; ++i) level = std::max(level, envelope[i]->loudness(v));
+            return level;
+        });
 
-        note[voiceIterator] = msb;
+        note[voice] = msb;
+        for(auto* a: attractor) a->start(msb, voice);
         for(int i = 0; i < 4; ++i)
         {
             if(oscillator[i]->mode() != VCO::Poly) 
@@ -109,29 +206,29 @@ namespace core
             }
             else 
             {
-                envelope[i]->start((float)lsb/(float)0x7F, voiceIterator);
+                envelope[i]->start((float)lsb/(float)0x7F, voice);
             }
         }
     }
 
-    void Spiro::noteOff(uint8_t msb)
+    void Spiro::release(const int voice) noexcept
     {
-        std::vector<int> to_process(active.begin(), active.end());
-        for (auto voice : to_process) 
+        for(int i = 0; i < 4; ++i) 
         {
-            if (note[voice] == msb) 
+            envelope[i]->hold[voice] = false;
+            if(envelope[i]->gate[voice] && oscillator[i]->mode() == VCO::Freerun) 
             {
-                for (int i = 0; i < 4; ++i) 
-                {
-                    envelope[i]->hold[voice] = false;
-                    if (oscillator[i]->mode() == VCO::Freerun) 
-                    {
-                        envelope[i]->jump(ENV::Release, voice);
-                        envelope[i]->next_stage(voice);
-                    }
-                }
+                envelope[i]->jump(ENV::Release, voice);
+                envelope[i]->next_stage(voice);
             }
-        }    
+        }
+    }
+
+    void Spiro::noteOff(uint8_t msb)
+    {
+        const int voice = voices.find(msb);
+        if(voice >= 0) release(voice);
+        if(note[VCO::Mono] == msb) release(VCO::Mono);
     }
 
     void Spiro::midiMessage(uint8_t status, uint8_t msb, uint8_t lsb)
@@ -147,13 +244,13 @@ namespace core
                 break;            
             
             case MidiMessage::PITCH_BEND:
-                com->ocv[com::cvo::p_wheel].store(float((lsb | (msb << 7)) - 8192.0f) / 8192.0f);
+                com->wheel[com::cvo::p_wheel] = float((lsb | (msb << 7)) - 8192.0f) / 8192.0f;
                 break;
 
             case MidiMessage::CONTROL_CHANGE:
                 if(msb == 1)  // Mod Wheel (CC #1)
                 {
-                    com->ocv[com::cvo::m_wheel].store(lsb / 127.0f * 2.0f - 1.0f);
+                    com->wheel[com::cvo::m_wheel] = lsb / 127.0f * 2.0f - 1.0f;
                 }
                 break;
 
@@ -162,19 +259,57 @@ namespace core
         }
     }
 
-    void Spiro::addConnection(int pos) noexcept
+    void Spiro::connect(const uint32_t output, const uint32_t input) noexcept
     {
-        ++activeOutputs[pos];
-        auto max = grid->sector[pos].descriptor->cv[map::cv::o];
-        if(activeOutputs[pos] > *max)[[unlikely]] activeOutputs[pos] = *max;
-        whitelist.emplace(pos);
+        auto o = decode_uid(output);
+        auto i = decode_uid(input);
+        bool queued = edits.push(Patch { Wire { rack.index(i.mt, i.mp), i.pp }, Wire { rack.index(o.mt, o.mp), o.pp } });
+        compile(!queued);
     }
-    
-    void Spiro::removeConnection(int pos) noexcept
+
+    void Spiro::disconnect(const uint32_t input) noexcept
     {
-        --activeOutputs[pos];
-        if(activeOutputs[pos] < 0)[[unlikely]] activeOutputs[pos] = 0;
-        if(!blacklist.contains(pos))[[likely]] whitelist.erase(pos);
+        auto i = decode_uid(input);
+        bool queued = edits.push(Patch { Wire { rack.index(i.mt, i.mp), i.pp }, Wire {} });
+        compile(!queued);
     }
-}
 
+    void Spiro::compile(const bool rewire) noexcept
+    {
+        auto& next = schedules.back();
+        bool edge[settings::sectors][settings::sectors] {};
+        bool local[settings::sectors][settings::sectors] {};
+        bool active[settings::sectors] {};
+        bool voiced[settings::sectors] {};
+
+        for(int i = 0; i < settings::sectors; ++i) voiced[i] = rack.voiced(i);
+        for(const auto pos: blacklist) active[pos] = true;
+        for(auto& wire: next.wiring) wire = Wire {};
+
+        if(bay != nullptr)
+        {
+            for(int x = 0; x < bay->inputs; ++x)
+            {
+                for(int y = 0; y < bay->outputs; ++y)
+                {
+                    if(!bay->matrix.get(x, y)) continue;
+                    edge[sink[x].module][source[y].module] = true;
+                    active[source[y].module] = true;
+                    next.wiring[x] = source[y];
+                }
+            }
+        }
+
+        for(int i = 0; i < 4; ++i)              // Envelope levels are read by the paired oscillator, voice by voice
+        {
+            const int vco = rack.index(map::module::type::vco, i), env = rack.index(map::module::type::env, i);
+            local[vco][env] = !edge[vco][env];  // Unless also patched, the cable is read summed
+            edge [vco][env] = true;
+        }
+
+        if(rewire) ++resync;
+        next.resync = resync;
+        next.compile(edge, local, active, voiced);
+        schedules.publish();
+    }
+}
@@ -21,48 +21,115 @@
 ******************************************************************************************************************************/
 #pragma once
 #include "modmatrix.hpp"
+#include "modules/com.hpp"
+#include "modules/cso.hpp"
 #include "modules/env.hpp"
 #include "modules/node.hpp"
 #include "modules/vco.hpp"
+#include "pool.hpp"
 #include "rack.hpp"
+#include "schedule.hpp"
 #include "setup/midi.h"
+#include "utility/halfband.hpp"
+#include "utility/rtcheck.hpp"
+#include "utility/spsc.hpp"
+#include "utility/triple.hpp"
+#include "voices.hpp"
+#include <algorithm>
 #include <atomic>
 #include <set>
 #include <cstdint>
-#include <functional>
+#include <memory>
 
 
 namespace core 
 {
+    struct Event                                    // MIDI message at a frame of the host block
+    {
+        int offset;
+        uint8_t status;
+        uint8_t msb;
+        uint8_t lsb;
+    };
+
     class Spiro
     { 
         public:
             struct stereo { enum { l, r }; };
         private:
-            uint8_t note[settings::poly];
-            int voiceIterator = 1;
-            std::set<int> active;                   // Active voices
-            std::set<int> whitelist;                // Active modules
+            uint8_t note[settings::poly] {};        // Voice -> note, 0 for the monophonic modes
             std::set<int> blacklist;                // Always ON modules
-            int* activeOutputs;
+            std::unique_ptr<Wire[]> source;         // Output socket -> module output
+            std::unique_ptr<Wire[]> sink;           // Input socket  -> module input
+            spsc<Patch, 256> edits;                 // Editor -> audio thread
+            triple<Schedule> schedules;             // Built by the editor, swapped in by the audio thread
+            const Schedule* schedule;               // Audio thread view
+            std::unique_ptr<Pool> pool;             // Parallel engine, null: single thread
+            unsigned resync = 0;                    // Editor side, last requested full rewire
+            unsigned applied = 0;                   // Audio side, last applied full rewire
             Module<float>* mixer; 
-            Module<float>* com;
+            COM* com;
             ENV* envelope[4];
             VCO* oscillator[4];
+            CSO* attractor[settings::population(map::module::type::cso)];
             void noteOn (uint8_t, uint8_t);
             void noteOff(uint8_t);
-            void resetVoice(int);
+            void release(const int) noexcept;      // Let the envelopes of a voice go
+            int factor = 1;                         // Engine frames per host frame
+            unsigned rate = settings::rate;         // Engine frames per second, handed to the rack
+            Decimator down[2];
+            float decimated[2][settings::block];    // Host rate output when oversampling
+            void step(const int) noexcept;          // n host frames
+            void consume() noexcept;                // Envelope events: oscillator gates follow their envelope
+            void route(const Wire&, const Wire&) noexcept;
+            void update() noexcept;
 
         public:
             const Grid* grid;
             Rack rack;
             Patchbay* bay = nullptr;
-            std::atomic<float> out[2];                       // LR Output
+            Voices voices;
+            std::atomic<unsigned> opened {0};       // Oscillator gates opened and closed by envelope events,
+            std::atomic<unsigned> closed {0};       // equal once every voice has rung out: a gap is a voice leak
+            const float* out[2];                             // LR Output [settings::block]
             void midiMessage(uint8_t, uint8_t, uint8_t);
-            void process() noexcept;
-            void addConnection(int pos) noexcept;
-            void removeConnection(int pos) noexcept;
+            void process(const int) noexcept;
+            template <typename Sink>
+            void render(const int, const Event*, const int, Sink&&) noexcept;
+            void parallel(const int);               // Helper threads, 0: single thread. Not while processing
+            void oversample(const unsigned, const int, const Decimator::quality);   // Host rate, factor 1, 2, 4 or 8. Not while processing
+            int latency() const noexcept;           // Host frames added by the decimator
+            void connect(const uint32_t, const uint32_t) noexcept;
+            void disconnect(const uint32_t) noexcept;
+            void compile(const bool = false) noexcept;
             Spiro(const Grid*);
-           ~Spiro();
+           ~Spiro() = default;
     };
+
+   /**********************************************************************************************************************
+    * 
+    *  Render a host block, split at the frame of every event, in sub-blocks of at most settings::block.
+    *  When oversampling, each sub-block runs factor times as many engine frames and is decimated back.
+    *  Events closer than settings::split to the previous split land at the end of that sub-block.
+    *  sink(offset, n) copies out each sub-block.
+    *
+    **********************************************************************************************************************/
+    template <typename Sink>
+    void Spiro::render(const int frames, const Event* events, const int count, Sink&& sink) noexcept
+    {
+        rt::Scope audio;
+        int e = 0;
+        for(int offset = 0; offset < frames;)
+        {
+            for(; e < count && events[e].offset <= offset; ++e) midiMessage(events[e].status, events[e].msb, events[e].lsb);
+
+            int end = std::min(frames, offset + settings::block);
+            if(e < count) end = std::min(end, std::max(events[e].offset, offset + settings::split));
+
+            step(end - offset);
+            sink(offset, end - offset);
+            offset = end;
+        }
+        for(; e < count; ++e) midiMessage(events[e].status, events[e].msb, events[e].lsb);
+    }
 };
@@ -0,0 +1,75 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include <cstddef>
+#include <new>
+
+namespace core {
+
+    constexpr std::size_t cacheline { 64 };
+    constexpr std::size_t align(const std::size_t n) noexcept { return (n + cacheline - 1) & ~(cacheline - 1); }
+
+   /***************************************************************************************************************************
+    * 
+    *  Region
+    *  Bump allocator over memory it does not own, every request starts on a cache line.
+    * 
+    **************************************************************************************************************************/
+    class Region
+    {
+        private:
+            std::byte* data;
+            std::size_t used = 0;
+
+        public:
+            const std::size_t size;
+            std::size_t footprint() const noexcept { return used; }
+
+            template <typename T>
+            T* take(const std::size_t n) noexcept                   // nullptr when exhausted
+            {
+                const std::size_t bytes = align(n * sizeof(T));
+                if(used + bytes > size) return nullptr;
+                T* p = reinterpret_cast<T*>(data + used);
+                for(std::size_t i = 0; i < n; ++i) new (p + i) T {};
+                used += bytes;
+                return p;
+            }
+
+            Region(std::byte* d, const std::size_t n): data(d), size(n) {}
+    };
+
+   /***************************************************************************************************************************
+    * 
+    *  Arena
+    *  Hot: touched every frame (input pointers, output buffers)
+    *  Cold: touched once per block or by the editor (control pointers, output tables)
+    * 
+    **************************************************************************************************************************/
+    struct Arena
+    {
+        Region hot;
+        Region cold;
+        Arena(std::byte* d, const std::size_t h, const std::size_t c): hot(d, h), cold(d + h, c) {}
+    };
+};
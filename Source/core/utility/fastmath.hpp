@@ -0,0 +1,166 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include "constants.hpp"
+#include "simd.hpp"
+#include <bit>
+#include <cstdint>
+
+namespace core::fast {
+
+   /***************************************************************************************************************************
+    * 
+    *  Fast math
+    *  Polynomial stand-ins for libm in the audio path, written once over float and simd::vf.
+    *  No libm call, no table, no branch: a vf argument evaluates every lane the same way.
+    *  Errors are the largest seen against double precision libm over the stated range, spiro_bench math checks them.
+    * 
+    *  Function     Range                  Max error
+    *  sin, cos     |x| < 2^12             2.5e-7 absolute
+    *  tan          |x| < 1.3              5.0e-7 relative
+    *  atan         any                    2.0e-7 absolute
+    *  exp2         -126 < x < 126         3.0e-7 relative
+    *  exp          -87 < x < 87           4.0e-7 relative
+    *  tanh         any                    3.0e-7 absolute
+    * 
+    **************************************************************************************************************************/
+    template <typename T> struct ops;
+
+    template <> struct ops<float>
+    {
+        static float k(const float c) noexcept { return c; }
+        static float select(const bool m, const float a, const float b) noexcept { return m ? a : b; }
+        static float min(const float a, const float b) noexcept { return b < a ? b : a; }
+        static float max(const float a, const float b) noexcept { return a < b ? b : a; }
+        static float exponent(const float i) noexcept           // 2^i, i integral: i + 127 lands in the low mantissa bits
+        {
+            return std::bit_cast<float>(std::bit_cast<std::uint32_t>(i + 8388735.0f) << 23);
+        }
+    };
+
+    template <> struct ops<simd::vf>
+    {
+        using vf = simd::vf;
+        static vf k(const float c) noexcept { return simd::set(c); }
+        static vf select(const simd::vm m, const vf a, const vf b) noexcept { return simd::select(m, a, b); }
+        static vf min(const vf a, const vf b) noexcept { return simd::min(a, b); }
+        static vf max(const vf a, const vf b) noexcept { return simd::max(a, b); }
+        static vf exponent(const vf i) noexcept { return simd::exponent(simd::truncate(i)); }
+    };
+
+    namespace detail
+    {
+        template <typename T, typename O = ops<T>>
+        T nearest(const T x) noexcept                           // Round to nearest for |x| < 2^22, without a branch or a
+        {                                                       // conversion, so that float loops vectorise. Not under -ffast-math
+            return (x + O::k(12582912.0f)) - O::k(12582912.0f);
+        }
+
+        template <typename T, typename O = ops<T>>
+        T sine(const T r) noexcept                              // |r| <= pi / 2, Taylor to x^11
+        {
+            const T r2 = r * r;
+            return r * (O::k(1.0f) + r2 * (O::k(-1.6666667e-1f) + r2 * (O::k(8.3333333e-3f) + r2 * (O::k(-1.9841270e-4f)
+                     + r2 * (O::k(2.7557319e-6f) + r2 * O::k(-2.5052108e-8f))))));
+        }
+
+        template <typename T, typename O = ops<T>>
+        T cosine(const T r) noexcept                            // |r| <= pi / 2, Taylor to x^12
+        {
+            const T r2 = r * r;
+            return O::k(1.0f) + r2 * (O::k(-0.5f) + r2 * (O::k(4.1666667e-2f) + r2 * (O::k(-1.3888889e-3f)
+                 + r2 * (O::k(2.4801587e-5f) + r2 * (O::k(-2.7557319e-7f) + r2 * O::k(2.0876757e-9f))))));
+        }
+
+        template <typename T, typename O = ops<T>>
+        T turn(const T x) noexcept                              // x wrapped to [-pi, pi], tao split in two for precision
+        {
+            const T q = nearest(x * O::k(1.0f / tao));
+            return (x - q * O::k(6.28125f)) - q * O::k(static_cast<float>(tao - 6.28125));
+        }
+    }
+
+    template <typename T, typename O = ops<T>>
+    T sin(const T x) noexcept
+    {
+        const T r = detail::turn(x);
+        const T a = O::max(r, O::k(0.0f) - r);
+        const T s = detail::sine(O::k(pi * 0.5f) - O::max(O::k(pi * 0.5f) - a, a - O::k(pi * 0.5f)));   // Folded to [0, pi / 2]
+        return O::select(r < O::k(0.0f), O::k(0.0f) - s, s);
+    }
+
+    template <typename T, typename O = ops<T>>
+    T cos(const T x) noexcept
+    {
+        const T r = detail::turn(x);
+        return detail::sine(O::k(pi * 0.5f) - O::max(r, O::k(0.0f) - r));
+    }
+
+    template <typename T, typename O = ops<T>>
+    T tan(const T x) noexcept
+    {
+        return detail::sine(x) / detail::cosine(x);
+    }
+
+    template <typename T, typename O = ops<T>>
+    T atan(const T x) noexcept                                  // Abramowitz and Stegun 4.4.49 on [0, 1], reflected outside
+    {
+        const T a = O::max(x, O::k(0.0f) - x);
+        const T t = O::min(a, O::k(1.0f) / O::max(a, O::k(1.0f)));
+        const T t2 = t * t;
+        T p = t * (O::k(0.9999993329f) + t2 * (O::k(-0.3332985605f) + t2 * (O::k(0.1994653599f) + t2 * (O::k(-0.1390853351f)
+                 + t2 * (O::k(0.0964200441f) + t2 * (O::k(-0.0559098861f) + t2 * (O::k(0.0218612288f) + t2 * O::k(-0.0040540580f))))))));
+        const T q = O::k(pi * 0.5f) - p;
+        p = O::select(O::k(1.0f) < a, q, p);
+        return O::select(x < O::k(0.0f), O::k(0.0f) - p, p);
+    }
+
+    template <typename T, typename O = ops<T>>
+    T exp2(const T x) noexcept                                  // 2^i times a Taylor polynomial of 2^f, |f| <= 1/2
+    {
+        const T c = O::min(O::max(x, O::k(-126.0f)), O::k(126.0f));
+        const T i = detail::nearest(c);
+        const T f = c - i;
+        const T p = O::k(1.0f) + f * (O::k(6.9314718e-1f) + f * (O::k(2.4022651e-1f) + f * (O::k(5.5504109e-2f)
+                  + f * (O::k(9.6181291e-3f) + f * (O::k(1.3333558e-3f) + f * O::k(1.5403530e-4f))))));
+        return p * O::exponent(i);
+    }
+
+    template <typename T, typename O = ops<T>>
+    T exp(const T x) noexcept                                   // 2^i times a Taylor polynomial of e^r, |r| <= ln2 / 2
+    {
+        const T c = O::min(O::max(x, O::k(-87.0f)), O::k(87.0f));
+        const T i = detail::nearest(c * O::k(1.4426950f));
+        const T r = (c - i * O::k(0.693359375f)) - i * O::k(-2.12194440e-4f);       // ln2 split in two
+        const T p = O::k(1.0f) + r * (O::k(1.0f) + r * (O::k(0.5f) + r * (O::k(1.6666667e-1f)
+                  + r * (O::k(4.1666667e-2f) + r * (O::k(8.3333333e-3f) + r * O::k(1.3888889e-3f))))));
+        return p * O::exponent(i);
+    }
+
+    template <typename T, typename O = ops<T>>
+    T tanh(const T x) noexcept                                  // (e^2x - 1) / (e^2x + 1), flat past |x| = 9
+    {
+        const T e = exp2(O::min(O::max(x, O::k(-9.0f)), O::k(9.0f)) * O::k(2.8853901f));
+        return (e - O::k(1.0f)) / (e + O::k(1.0f));
+    }
+}
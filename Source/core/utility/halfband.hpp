@@ -0,0 +1,164 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include "constants.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+
+   /***************************************************************************************************************************
+    * 
+    *  Half-band decimator
+    *  Halves the rate with a linear phase FIR of 4P - 1 taps, P a multiple of 4.
+    *  Every other tap is zero but the centre one, so the filter runs as two phases:
+    *  odd samples only meet the centre tap after a delay of P, even samples meet a symmetric
+    *  kernel of 2P taps read from a window that never wraps, eight partial sums at a time.
+    *  Taps: Kaiser windowed sinc, unity gain at DC.
+    * 
+    **************************************************************************************************************************/
+    class Halfband
+    {
+        public:
+            static constexpr int most = 32;                 // Largest P
+
+        private:
+            float kernel[2 * most] {};
+            float even[4 * most] {};                        // Window written twice
+            float odd[most] {};                             // Delay line of the odd phase
+            int taps = 8;                                   // 2P
+            int head = 0;
+            int tail = 0;
+
+            static double bessel(const double x) noexcept   // I0
+            {
+                double sum = 1.0, term = 1.0;
+                for(int k = 1; k < 32; ++k)
+                {
+                    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                    sum  += term;
+                }
+                return sum;
+            }
+
+        public:
+            void design(const int p, const double beta) noexcept
+            {
+                taps = 2 * std::clamp(p / 4 * 4, 4, most);
+                const int half = taps / 2, span = 2 * taps - 1;
+                double sum = 0.0;
+                for(int i = 0; i < half; ++i)
+                {
+                    const int n = 2 * i + 1;                // Distance from the centre tap
+                    const double r = static_cast<double>(n) / (span / 2 + 1);
+                    const double g = std::sin(pi * n / 2.0) / (pi * n) * bessel(beta * std::sqrt(1.0 - r * r)) / bessel(beta);
+                    kernel[half - 1 - i] = kernel[half + i] = static_cast<float>(g);
+                    sum += 2.0 * g;
+                }
+                for(int j = 0; j < taps; ++j) kernel[j] = static_cast<float>(kernel[j] * 0.5 / sum);   // Centre 0.5, side lobes 0.5
+                reset();
+            }
+
+            void reset() noexcept
+            {
+                std::fill_n(even, 4 * most, 0.0f);
+                std::fill_n(odd, most, 0.0f);
+                head = tail = 0;
+            }
+
+            int latency() const noexcept { return taps - 1; }          // Group delay, in input samples
+
+            float process(const float a, const float b) noexcept        // Two input samples, one out
+            {
+                even[head] = even[head + taps] = a;
+                if(++head == taps) head = 0;
+
+                const float* window = even + head;
+                float acc[8] {};
+                for(int j = 0; j < taps; j += 8)
+                {
+                    for(int k = 0; k < 8; ++k) acc[k] += kernel[j + k] * window[j + k];
+                }
+                float y = 0.5f * odd[tail];
+                for(int k = 0; k < 8; ++k) y += acc[k];
+
+                odd[tail] = b;
+                if(++tail == taps / 2) tail = 0;
+                return y;
+            }
+    };
+
+   /***************************************************************************************************************************
+    * 
+    *  Decimator
+    *  Brings an oversampled signal back to the host rate through one half-band stage per octave.
+    *  Presets trade CPU for rejection: only the last stage sees a narrow transition band,
+    *  the earlier ones run at higher rates with short kernels.
+    * 
+    *  Quality     Last stage   Earlier stages   Kaiser beta
+    *  eco         31 taps      15 taps          6
+    *  standard    63 taps      15 taps          8
+    *  high       127 taps      31 taps          10
+    * 
+    **************************************************************************************************************************/
+    class Decimator
+    {
+        public:
+            enum quality { eco, standard, high };
+
+        private:
+            struct Preset { int last, early; double beta; };
+            static constexpr Preset preset[3] { { 8, 4, 6.0 }, { 16, 4, 8.0 }, { 32, 8, 10.0 } };
+            Halfband stage[3];
+            int stages = 0;
+            float scratch[settings::block];
+
+        public:
+            void setup(const int factor, const quality q) noexcept      // Factor 1, 2, 4 or 8
+            {
+                stages = factor >= 8 ? 3 : factor >= 4 ? 2 : factor >= 2 ? 1 : 0;
+                for(int i = 0; i < stages; ++i) stage[i].design(i == stages - 1 ? preset[q].last : preset[q].early, preset[q].beta);
+            }
+
+            int latency() const noexcept                                // Group delay, in host samples
+            {
+                double d = 0.0;
+                for(int i = 0; i < stages; ++i) d = (d + stage[i].latency()) / 2.0;    // Each stage halves the delay before it
+                return static_cast<int>(std::lround(d));
+            }
+
+            void process(const float* in, float* out, const int n) noexcept    // n << stages samples in, n out
+            {
+                if(stages == 0) return (void)std::copy_n(in, n, out);
+                int length = n << stages;
+                const float* from = in;
+                for(int i = 0; i < stages; ++i)
+                {
+                    length /= 2;
+                    float* to = i == stages - 1 ? out : scratch;
+                    for(int s = 0; s < length; ++s) to[s] = stage[i].process(from[2 * s], from[2 * s + 1]);
+                    from = scratch;
+                }
+            }
+    };
+};
@@ -131,18 +131,14 @@ void Patchbay::connect(Socket* a, Socket* b)
 
     if(a->route == SOCKET_IN)
     {
-        a->data = b->data;
         matrix.set(a->pos, b->pos, true);
+        on_connect(b->id, a->id);
     }
     else
     {
-        b->data = a->data;
         matrix.set(b->pos, a->pos, true);
+        on_connect(a->id, b->id);
     }
-    *a->com = a->data;
-    *b->com = b->data;
-    
-    on_connect(a->route == SOCKET_OUT? a->id: b->id);
 }
 
 void Patchbay::disconnect(Socket* a, Socket* b)
@@ -150,33 +146,29 @@ void Patchbay::disconnect(Socket* a, Socket* b)
     a->on = false;
     b->on = false;
 
+    a->to = nullptr;
+    b->to = nullptr;
+
     if(a->route == SOCKET_IN)
     {
-        a->data = &zero;
-        *a->com = a->data;
         matrix.set(a->pos, b->pos, false);
+        on_disconnect(b->id, a->id);
     }
     else
     {
-        b->data = &zero;
-        *b->com = b->data;
         matrix.set(b->pos, a->pos, false);
+        on_disconnect(a->id, b->id);
     }
-
-    a->to = nullptr;
-    b->to = nullptr;
-
-    on_disconnect(a->route == SOCKET_OUT? a->id: b->id);
 }
 
 void Patchbay::clear()
 {
     for(int i = 0; i < nodes; i++)
     {
-        if(io[i].route == SOCKET_IN) io[i].data = &zero;
         io[i].collapse();
         io[i].on = false;
     }
+    if(on_clear) on_clear();
 }
 
 void Patchbay::draw()
@@ -379,7 +371,7 @@ Patchbay::~Patchbay()
     delete[] io;
 }
 
-void Patchbay::set_socket(const Point2D<int>* o, const int& radius, const uint32_t& id, const bool& route, const int& p)
+void Patchbay::set_socket(const Point2D<int>* o, const int& radius, const uint32_t& id, const bool& route, const int& p, const bool& poly)
 {
     io[counter].bounds.xCentre = o->x;
     io[counter].bounds.yCentre = o->y;
@@ -387,7 +379,7 @@ void Patchbay::set_socket(const Point2D<int>* o, const int& radius, const uint32
     io[counter].id = id;
     io[counter].pos = p;
     io[counter].route = route;
-    io[counter].data = &zero;
+    io[counter].poly  = poly;
     io[counter].collapse();
     ++counter;
 }
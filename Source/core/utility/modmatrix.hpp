@@ -73,10 +73,9 @@ namespace core {
         int pos;                                            // Array position
         bool route = 0;                                     // 0: Output - 1: Input
         bool on = false;                                    // Is connected ?
+        bool poly = false;                                  // Port carries one lane per voice
         Socket* to = nullptr;
 
-        std::atomic<float>* data  = &zero;                  // Output
-        std::atomic<float>** com  = &data;                  // Pointer to module input pointer
         constexpr void collapse();                          // Collapse to centre
         constexpr void drag(const float&, const float&);
         Socket(int);
@@ -99,8 +98,9 @@ namespace core {
             const int get_index(const uint32_t&) const;
             void  connect(Socket*, Socket*);
             void  disconnect(Socket*, Socket*);
-            std::function<void(uint32_t)> on_connect;
-            std::function<void(uint32_t)> on_disconnect;
+            std::function<void(uint32_t, uint32_t)> on_connect;         // (Output id, Input id)
+            std::function<void(uint32_t, uint32_t)> on_disconnect;
+            std::function<void()> on_clear;
 
             Canvas<unsigned>    canvas;         // Hit test layer
             Canvas<bool>        matrix;         // Connections matrix
@@ -110,7 +110,7 @@ namespace core {
             const int inputs;
             const int outputs;
             
-            void set_socket(const Point2D<int>*, const int&, const uint32_t&, const bool&, const int&);
+            void set_socket(const Point2D<int>*, const int&, const uint32_t&, const bool&, const int&, const bool& = false);
             void drag(const float&, const float&);
             void draw();
             int  down_test(const float&, const float&, const int&);
@@ -0,0 +1,168 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "rtcheck.hpp"
+#include <atomic>
+
+#if defined(SPIRO_RTCHECK) && defined(__GLIBC__)
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void* __libc_memalign(size_t, size_t);
+    void  __libc_free(void*);
+}
+
+namespace core::rt {
+
+    namespace
+    {
+        constexpr int depth   = 24;                     // Frames kept per stack
+        constexpr int records = 64;                     // Distinct stacks kept
+
+        struct Record
+        {
+            kind what;
+            int frames;
+            void* frame[depth];
+            unsigned long count;
+        };
+
+        const char* name[kinds] { "allocate", "release", "lock" };
+
+        thread_local int open = 0;                      // Scopes open on this thread
+        thread_local bool busy = false;                 // Inside the checker itself
+
+        std::atomic_flag guard = ATOMIC_FLAG_INIT;
+        Record record[records];
+        int used = 0;
+        unsigned long dropped = 0;                      // Stacks past the table
+        std::atomic<unsigned long> total = 0;
+
+        using lock_fn = int (*)(pthread_mutex_t*);
+        lock_fn next_lock = nullptr;
+
+        void flag(const kind what) noexcept
+        {
+            if(open == 0 || busy) return;
+            busy = true;
+            void* frame[depth];
+            const int frames = backtrace(frame, depth);
+            total.fetch_add(1, std::memory_order_relaxed);
+
+            while(guard.test_and_set(std::memory_order_acquire)) {}
+            int i = 0;
+            while(i < used && !(record[i].what == what && record[i].frames == frames && std::memcmp(record[i].frame, frame, frames * sizeof(void*)) == 0)) ++i;
+            if(i < used) ++record[i].count;
+            else if(used < records)
+            {
+                record[used] = Record { what, frames, {}, 1 };
+                std::memcpy(record[used].frame, frame, frames * sizeof(void*));
+                ++used;
+            }
+            else ++dropped;
+            guard.clear(std::memory_order_release);
+            busy = false;
+        }
+
+        struct Prime                                    // backtrace() allocates on its first call, get it over with
+        {
+            Prime()
+            {
+                void* frame[1];
+                backtrace(frame, 1);
+                next_lock = reinterpret_cast<lock_fn>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+            }
+        } prime;
+    }
+
+    void enter() noexcept { ++open; }
+    void leave() noexcept { --open; }
+
+    unsigned long violations() noexcept { return total.load(std::memory_order_relaxed); }
+
+    void report(std::ostream& out)
+    {
+        while(guard.test_and_set(std::memory_order_acquire)) {}
+        Record copy[records];
+        const int n = used;
+        std::memcpy(copy, record, n * sizeof(Record));
+        const unsigned long lost = dropped;
+        guard.clear(std::memory_order_release);
+
+        out << "-- Real-time check: " << violations() << " violations, " << n << " stacks\n";
+        for(int i = 0; i < n; ++i)
+        {
+            out << "-- " << name[copy[i].what] << " x" << copy[i].count << "\n";
+            char** symbol = backtrace_symbols(copy[i].frame, copy[i].frames);
+            for(int f = 1; f < copy[i].frames; ++f) out << "     " << (symbol ? symbol[f] : "?") << "\n";
+            std::free(symbol);
+        }
+        if(lost) out << "-- " << lost << " violations past the stack table\n";
+    }
+}
+
+/*****************************************************************************************************************************
+* 
+*  Interposed entry points, forwarded to glibc
+* 
+*****************************************************************************************************************************/
+extern "C"
+{
+    void* malloc(size_t size)                           { core::rt::flag(core::rt::allocate); return __libc_malloc(size); }
+    void* calloc(size_t count, size_t size)             { core::rt::flag(core::rt::allocate); return __libc_calloc(count, size); }
+    void* realloc(void* p, size_t size)                 { core::rt::flag(core::rt::allocate); return __libc_realloc(p, size); }
+    void* aligned_alloc(size_t align, size_t size)      { core::rt::flag(core::rt::allocate); return __libc_memalign(align, size); }
+    void* memalign(size_t align, size_t size)           { core::rt::flag(core::rt::allocate); return __libc_memalign(align, size); }
+    void  free(void* p)                                 { if(p) core::rt::flag(core::rt::release); __libc_free(p); }
+
+    int posix_memalign(void** p, size_t align, size_t size)
+    {
+        core::rt::flag(core::rt::allocate);
+        *p = __libc_memalign(align, size);
+        return *p ? 0 : ENOMEM;
+    }
+
+    int pthread_mutex_lock(pthread_mutex_t* m)
+    {
+        core::rt::flag(core::rt::lock);
+        if(!core::rt::next_lock) core::rt::next_lock = reinterpret_cast<core::rt::lock_fn>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+        return core::rt::next_lock(m);
+    }
+}
+
+#else
+
+namespace core::rt {
+    unsigned long violations() noexcept { return 0; }
+    void report(std::ostream&) {}
+}
+
+#endif
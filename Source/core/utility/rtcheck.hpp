@@ -0,0 +1,60 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include <ostream>
+
+namespace core::rt {
+
+   /***************************************************************************************************************************
+    * 
+    *  Real-time safety check
+    *  Built with SPIRO_RTCHECK on glibc, the malloc family, free and pthread_mutex_lock are interposed.
+    *  Any call made while a Scope is open on the calling thread is counted with its stack,
+    *  report() prints them from a non real-time thread.
+    *  Interposition reaches executables (standalone, spiro_render, spiro_bench), not a plugin loaded by a host.
+    *  Without the flag Scope is empty and report() prints nothing.
+    * 
+    **************************************************************************************************************************/
+    enum kind { allocate, release, lock, kinds };
+
+#if defined(SPIRO_RTCHECK) && defined(__GLIBC__)
+    constexpr bool enabled = true;
+    void enter() noexcept;
+    void leave() noexcept;
+#else
+    constexpr bool enabled = false;
+    inline void enter() noexcept {}
+    inline void leave() noexcept {}
+#endif
+
+    struct Scope                                        // Marks the audio thread while alive
+    {
+        Scope() noexcept { enter(); }
+       ~Scope() noexcept { leave(); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    unsigned long violations() noexcept;                // Total since start
+    void report(std::ostream&);                         // Counts and stacks, call outside of a Scope
+}
@@ -0,0 +1,218 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#else
+    #include <bit>
+#endif
+
+namespace core::simd {
+
+   /***************************************************************************************************************************
+    * 
+    *  Float lanes
+    *  The widest vector the target is built for: 8 lanes with AVX2, 4 with SSE2 or NEON, plain arrays of 4 otherwise.
+    *  vf holds floats, vi 32 bit integers, vm the mask of a comparison.
+    *  Only what the voice kernels and fastmath.hpp use: arithmetic, min and max, compare and select, truncation,
+    *  2^i from an integer exponent, gather and a horizontal sum.
+    *  Points in space fill every group of four lanes as x, y, z, 0: triple() sets one, yzx() and zxy() rotate its axes.
+    * 
+    **************************************************************************************************************************/
+#if defined(__AVX2__)
+    constexpr int width = 8;
+    struct vf { __m256  v; };
+    struct vi { __m256i v; };
+    struct vm { __m256  v; };
+
+    inline vf set(const float x) noexcept                   { return { _mm256_set1_ps(x) }; }
+    inline vf load(const float* p) noexcept                 { return { _mm256_loadu_ps(p) }; }
+    inline vi load(const int* p) noexcept                   { return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)) }; }
+    inline void store(float* p, const vf a) noexcept        { _mm256_storeu_ps(p, a.v); }
+    inline vf operator+(const vf a, const vf b) noexcept    { return { _mm256_add_ps(a.v, b.v) }; }
+    inline vf operator-(const vf a, const vf b) noexcept    { return { _mm256_sub_ps(a.v, b.v) }; }
+    inline vf operator*(const vf a, const vf b) noexcept    { return { _mm256_mul_ps(a.v, b.v) }; }
+    inline vf operator/(const vf a, const vf b) noexcept    { return { _mm256_div_ps(a.v, b.v) }; }
+    inline vf min(const vf a, const vf b) noexcept          { return { _mm256_min_ps(a.v, b.v) }; }
+    inline vf max(const vf a, const vf b) noexcept          { return { _mm256_max_ps(a.v, b.v) }; }
+    inline vi operator+(const vi a, const vi b) noexcept    { return { _mm256_add_epi32(a.v, b.v) }; }
+    inline vm operator<(const vf a, const vf b) noexcept    { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+    inline vm operator>=(const vf a, const vf b) noexcept   { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+    inline vf select(const vm m, const vf a, const vf b) noexcept { return { _mm256_blendv_ps(b.v, a.v, m.v) }; }
+    inline vi truncate(const vf a) noexcept                 { return { _mm256_cvttps_epi32(a.v) }; }
+    inline vf convert(const vi a) noexcept                  { return { _mm256_cvtepi32_ps(a.v) }; }
+    inline vf exponent(const vi a) noexcept                 { return { _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(a.v, _mm256_set1_epi32(127)), 23)) }; }
+    inline vf gather(const float* base, const vi i) noexcept { return { _mm256_i32gather_ps(base, i.v, 4) }; }
+    inline vf triple(const float x, const float y, const float z) noexcept { return { _mm256_setr_ps(x, y, z, 0.0f, x, y, z, 0.0f) }; }
+    inline vf yzx(const vf a) noexcept                      { return { _mm256_permute_ps(a.v, _MM_SHUFFLE(3, 0, 2, 1)) }; }
+    inline vf zxy(const vf a) noexcept                      { return { _mm256_permute_ps(a.v, _MM_SHUFFLE(3, 1, 0, 2)) }; }
+    inline float sum(const vf a) noexcept
+    {
+        __m128 x = _mm_add_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+        x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+        return _mm_cvtss_f32(_mm_add_ss(x, _mm_shuffle_ps(x, x, 1)));
+    }
+
+#elif defined(__SSE2__) || defined(_M_X64)
+    constexpr int width = 4;
+    struct vf { __m128  v; };
+    struct vi { __m128i v; };
+    struct vm { __m128  v; };
+
+    inline vf set(const float x) noexcept                   { return { _mm_set1_ps(x) }; }
+    inline vf load(const float* p) noexcept                 { return { _mm_loadu_ps(p) }; }
+    inline vi load(const int* p) noexcept                   { return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)) }; }
+    inline void store(float* p, const vf a) noexcept        { _mm_storeu_ps(p, a.v); }
+    inline vf operator+(const vf a, const vf b) noexcept    { return { _mm_add_ps(a.v, b.v) }; }
+    inline vf operator-(const vf a, const vf b) noexcept    { return { _mm_sub_ps(a.v, b.v) }; }
+    inline vf operator*(const vf a, const vf b) noexcept    { return { _mm_mul_ps(a.v, b.v) }; }
+    inline vf operator/(const vf a, const vf b) noexcept    { return { _mm_div_ps(a.v, b.v) }; }
+    inline vf min(const vf a, const vf b) noexcept          { return { _mm_min_ps(a.v, b.v) }; }
+    inline vf max(const vf a, const vf b) noexcept          { return { _mm_max_ps(a.v, b.v) }; }
+    inline vi operator+(const vi a, const vi b) noexcept    { return { _mm_add_epi32(a.v, b.v) }; }
+    inline vm operator<(const vf a, const vf b) noexcept    { return { _mm_cmplt_ps(a.v, b.v) }; }
+    inline vm operator>=(const vf a, const vf b) noexcept   { return { _mm_cmpge_ps(a.v, b.v) }; }
+    inline vf select(const vm m, const vf a, const vf b) noexcept { return { _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)) }; }
+    inline vi truncate(const vf a) noexcept                 { return { _mm_cvttps_epi32(a.v) }; }
+    inline vf convert(const vi a) noexcept                  { return { _mm_cvtepi32_ps(a.v) }; }
+    inline vf exponent(const vi a) noexcept                 { return { _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(a.v, _mm_set1_epi32(127)), 23)) }; }
+    inline vf gather(const float* base, const vi i) noexcept
+    {
+        alignas(16) int k[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(k), i.v);
+        return { _mm_setr_ps(base[k[0]], base[k[1]], base[k[2]], base[k[3]]) };
+    }
+    inline vf triple(const float x, const float y, const float z) noexcept { return { _mm_setr_ps(x, y, z, 0.0f) }; }
+    inline vf yzx(const vf a) noexcept                      { return { _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(3, 0, 2, 1)) }; }
+    inline vf zxy(const vf a) noexcept                      { return { _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(3, 1, 0, 2)) }; }
+    inline float sum(const vf a) noexcept
+    {
+        const __m128 x = _mm_add_ps(a.v, _mm_movehl_ps(a.v, a.v));
+        return _mm_cvtss_f32(_mm_add_ss(x, _mm_shuffle_ps(x, x, 1)));
+    }
+
+#elif defined(__ARM_NEON)
+    constexpr int width = 4;
+    struct vf { float32x4_t v; };
+    struct vi { int32x4_t   v; };
+    struct vm { uint32x4_t  v; };
+
+    inline vf set(const float x) noexcept                   { return { vdupq_n_f32(x) }; }
+    inline vf load(const float* p) noexcept                 { return { vld1q_f32(p) }; }
+    inline vi load(const int* p) noexcept                   { return { vld1q_s32(p) }; }
+    inline void store(float* p, const vf a) noexcept        { vst1q_f32(p, a.v); }
+    inline vf operator+(const vf a, const vf b) noexcept    { return { vaddq_f32(a.v, b.v) }; }
+    inline vf operator-(const vf a, const vf b) noexcept    { return { vsubq_f32(a.v, b.v) }; }
+    inline vf operator*(const vf a, const vf b) noexcept    { return { vmulq_f32(a.v, b.v) }; }
+    inline vf min(const vf a, const vf b) noexcept          { return { vminq_f32(a.v, b.v) }; }
+    inline vf max(const vf a, const vf b) noexcept          { return { vmaxq_f32(a.v, b.v) }; }
+#if defined(__aarch64__)
+    inline vf operator/(const vf a, const vf b) noexcept    { return { vdivq_f32(a.v, b.v) }; }
+#else
+    inline vf operator/(const vf a, const vf b) noexcept    // Estimate and two Newton steps
+    {
+        float32x4_t r = vrecpeq_f32(b.v);
+        r = vmulq_f32(vrecpsq_f32(b.v, r), r);
+        r = vmulq_f32(vrecpsq_f32(b.v, r), r);
+        return { vmulq_f32(a.v, r) };
+    }
+#endif
+    inline vi operator+(const vi a, const vi b) noexcept    { return { vaddq_s32(a.v, b.v) }; }
+    inline vm operator<(const vf a, const vf b) noexcept    { return { vcltq_f32(a.v, b.v) }; }
+    inline vm operator>=(const vf a, const vf b) noexcept   { return { vcgeq_f32(a.v, b.v) }; }
+    inline vf select(const vm m, const vf a, const vf b) noexcept { return { vbslq_f32(m.v, a.v, b.v) }; }
+    inline vi truncate(const vf a) noexcept                 { return { vcvtq_s32_f32(a.v) }; }
+    inline vf convert(const vi a) noexcept                  { return { vcvtq_f32_s32(a.v) }; }
+    inline vf exponent(const vi a) noexcept                 { return { vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(a.v, vdupq_n_s32(127)), 23)) }; }
+    inline vf gather(const float* base, const vi i) noexcept
+    {
+        int k[4];
+        vst1q_s32(k, i.v);
+        const float x[4] { base[k[0]], base[k[1]], base[k[2]], base[k[3]] };
+        return { vld1q_f32(x) };
+    }
+    inline vf triple(const float x, const float y, const float z) noexcept
+    {
+        const float t[4] { x, y, z, 0.0f };
+        return { vld1q_f32(t) };
+    }
+    inline vf yzx(const vf a) noexcept
+    {
+        const float32x4_t t = vsetq_lane_f32(vgetq_lane_f32(a.v, 0), vextq_f32(a.v, a.v, 1), 2);
+        return { vsetq_lane_f32(vgetq_lane_f32(a.v, 3), t, 3) };
+    }
+    inline vf zxy(const vf a) noexcept
+    {
+        float32x4_t t = vsetq_lane_f32(vgetq_lane_f32(a.v, 0), vextq_f32(a.v, a.v, 2), 1);
+        t = vsetq_lane_f32(vgetq_lane_f32(a.v, 1), t, 2);
+        return { vsetq_lane_f32(vgetq_lane_f32(a.v, 3), t, 3) };
+    }
+    inline float sum(const vf a) noexcept
+    {
+        const float32x2_t x = vadd_f32(vget_low_f32(a.v), vget_high_f32(a.v));
+        return vget_lane_f32(vpadd_f32(x, x), 0);
+    }
+
+#else
+    constexpr int width = 4;
+    struct vf { float v[4]; };
+    struct vi { int   v[4]; };
+    struct vm { bool  v[4]; };
+
+    #define SPIRO_LANES(r, expression) for(int k = 0; k < 4; ++k) r.v[k] = expression; return r
+    inline vf set(const float x) noexcept                   { vf r; SPIRO_LANES(r, x); }
+    inline vf load(const float* p) noexcept                 { vf r; SPIRO_LANES(r, p[k]); }
+    inline vi load(const int* p) noexcept                   { vi r; SPIRO_LANES(r, p[k]); }
+    inline void store(float* p, const vf a) noexcept        { for(int k = 0; k < 4; ++k) p[k] = a.v[k]; }
+    inline vf operator+(const vf a, const vf b) noexcept    { vf r; SPIRO_LANES(r, a.v[k] + b.v[k]); }
+    inline vf operator-(const vf a, const vf b) noexcept    { vf r; SPIRO_LANES(r, a.v[k] - b.v[k]); }
+    inline vf operator*(const vf a, const vf b) noexcept    { vf r; SPIRO_LANES(r, a.v[k] * b.v[k]); }
+    inline vf operator/(const vf a, const vf b) noexcept    { vf r; SPIRO_LANES(r, a.v[k] / b.v[k]); }
+    inline vf min(const vf a, const vf b) noexcept          { vf r; SPIRO_LANES(r, b.v[k] < a.v[k] ? b.v[k] : a.v[k]); }
+    inline vf max(const vf a, const vf b) noexcept          { vf r; SPIRO_LANES(r, a.v[k] < b.v[k] ? b.v[k] : a.v[k]); }
+    inline vi operator+(const vi a, const vi b) noexcept    { vi r; SPIRO_LANES(r, a.v[k] + b.v[k]); }
+    inline vm operator<(const vf a, const vf b) noexcept    { vm r; SPIRO_LANES(r, a.v[k] < b.v[k]); }
+    inline vm operator>=(const vf a, const vf b) noexcept   { vm r; SPIRO_LANES(r, a.v[k] >= b.v[k]); }
+    inline vf select(const vm m, const vf a, const vf b) noexcept { vf r; SPIRO_LANES(r, m.v[k] ? a.v[k] : b.v[k]); }
+    inline vi truncate(const vf a) noexcept                 { vi r; SPIRO_LANES(r, static_cast<int>(a.v[k])); }
+    inline vf convert(const vi a) noexcept                  { vf r; SPIRO_LANES(r, static_cast<float>(a.v[k])); }
+    inline vf exponent(const vi a) noexcept                 { vf r; SPIRO_LANES(r, std::bit_cast<float>((a.v[k] + 127) << 23)); }
+    inline vf gather(const float* base, const vi i) noexcept { vf r; SPIRO_LANES(r, base[i.v[k]]); }
+    inline float sum(const vf a) noexcept                   { return (a.v[0] + a.v[1]) + (a.v[2] + a.v[3]); }
+    inline vf triple(const float x, const float y, const float z) noexcept { return { { x, y, z, 0.0f } }; }
+    inline vf yzx(const vf a) noexcept                      { return { { a.v[1], a.v[2], a.v[0], a.v[3] } }; }
+    inline vf zxy(const vf a) noexcept                      { return { { a.v[2], a.v[0], a.v[1], a.v[3] } }; }
+    #undef SPIRO_LANES
+#endif
+
+    inline vf floor(const vf a) noexcept                    // Within the int range
+    {
+        const vf t = convert(truncate(a));
+        return select(a < t, t - set(1.0f), t);
+    }
+}
@@ -0,0 +1,67 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include <atomic>
+
+namespace core {
+
+   /***************************************************************************************************************************
+    * 
+    *  Single producer, single consumer wait-free queue
+    *  One slot is kept free to tell a full queue from an empty one.
+    * 
+    **************************************************************************************************************************/
+    template <typename T, int N>
+    class spsc
+    {
+        private:
+            T data[N];
+            alignas(64) std::atomic<int> head = 0;          // Producer position
+            alignas(64) std::atomic<int> tail = 0;          // Consumer position
+
+        public:
+            bool push(const T&) noexcept;                   // false when full
+            bool pop(T&) noexcept;                          // false when empty
+    };
+
+    template <typename T, int N>
+    bool spsc<T, N>::push(const T& value) noexcept
+    {
+        const int i = head.load(std::memory_order_relaxed);
+        const int next = i + 1 < N ? i + 1 : 0;
+        if(next == tail.load(std::memory_order_acquire)) return false;
+        data[i] = value;
+        head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, int N>
+    bool spsc<T, N>::pop(T& value) noexcept
+    {
+        const int o = tail.load(std::memory_order_relaxed);
+        if(o == head.load(std::memory_order_acquire)) return false;
+        value = data[o];
+        tail.store(o + 1 < N ? o + 1 : 0, std::memory_order_release);
+        return true;
+    }
+};
@@ -0,0 +1,59 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include <atomic>
+
+namespace core {
+
+   /***************************************************************************************************************************
+    * 
+    *  Triple buffer
+    *  The writer fills back() and publishes it, the reader picks up the latest published copy. 
+    *  Neither side ever waits, intermediate copies may be skipped.
+    * 
+    **************************************************************************************************************************/
+    template <typename T>
+    class triple
+    {
+        private:
+            enum { index = 3, fresh = 4 };
+            T data[3] {};
+            std::atomic<int> middle = 1;                    // Exchanged slot | fresh
+            int write = 0;                                  // Writer slot
+            int read  = 2;                                  // Reader slot
+
+        public:
+            T& back() noexcept { return data[write]; }
+            const T& front() const noexcept { return data[read]; }
+            void publish() noexcept { write = middle.exchange(write | fresh, std::memory_order_acq_rel) & index; }
+            bool acquire() noexcept;                        // true when a new copy was picked up
+    };
+
+    template <typename T>
+    bool triple<T>::acquire() noexcept
+    {
+        if(!(middle.load(std::memory_order_relaxed) & fresh)) return false;
+        read = middle.exchange(read, std::memory_order_acq_rel) & index;
+        return true;
+    }
+};
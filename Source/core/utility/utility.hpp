@@ -28,6 +28,7 @@
 #include "iospecs.hpp"
 #include "constants.hpp"
 #include "primitives.hpp"
+#include "fastmath.hpp"
 
 namespace core {
 
@@ -41,9 +42,9 @@ struct OnePole
         float z;
 
     public:
-        void reset(const float ms)
+        void reset(const float ms, const unsigned rate)
         {
-            a = expf(- tao / (ms * 0.001f * settings::sample_rate));
+            a = expf(- tao / (ms * 0.001f * rate));
             b = 1.0f - a;
             z = 0.0f;
         }
@@ -52,7 +53,7 @@ struct OnePole
             z = (in * b) + (z * a);
             return z;
         }
-        OnePole() { reset(10.0f); };
+        OnePole() { reset(10.0f, settings::rate); };
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,7 +110,7 @@ struct Limiter
 
 inline Limiter::Limiter()
 {
-    init(1.0f, 10.0f, settings::sample_rate);
+    init(1.0f, 10.0f, settings::rate);
 }
 
 inline void Limiter::init(const float aMs, const float rMs, const float sample_rate)
@@ -123,7 +124,7 @@ inline float Limiter::process(const float in) noexcept
     e.process(out);
     if(e.envelope>threshold)
     {
-        out /= expf(e.envelope - threshold);
+        out *= std::exp(threshold - e.envelope);
     }
     return out;
 }
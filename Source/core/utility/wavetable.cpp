@@ -0,0 +1,96 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "wavetable.hpp"
+#include <complex>
+
+namespace core {
+
+    namespace
+    {
+        constexpr int oversize = 8192;                  // Samples drawn per cycle before band-limiting
+
+        void fft(std::complex<double>* x, const int n, const bool inverse)
+        {
+            for(int i = 1, j = 0; i < n; ++i)
+            {
+                int bit = n >> 1;
+                for(; j & bit; bit >>= 1) j ^= bit;
+                j ^= bit;
+                if(i < j) std::swap(x[i], x[j]);
+            }
+            for(int len = 2; len <= n; len <<= 1)
+            {
+                const std::complex<double> w = std::polar(1.0, (inverse ? 2.0 : -2.0) * pi / len);
+                for(int i = 0; i < n; i += len)
+                {
+                    std::complex<double> r = 1.0;
+                    for(int k = 0; k < len / 2; ++k, r *= w)
+                    {
+                        const auto a = x[i + k], b = x[i + k + len / 2] * r;
+                        x[i + k]           = a + b;
+                        x[i + k + len / 2] = a - b;
+                    }
+                }
+            }
+        }
+    }
+
+   /***************************************************************************************************************************
+    * 
+    *  Each slice is drawn oversampled, taken to the frequency domain once, then every level is resynthesised
+    *  from its share of the harmonics. The sample past the end of a level repeats the first for interpolation.
+    * 
+    **************************************************************************************************************************/
+    Wavetable::Wavetable(const Draw draw, const int n): slices(std::max(n, 1))
+    {
+        start[0] = 0;
+        for(int m = 0; m < levels; ++m) start[m + 1] = start[m] + size(m) + 1;
+        data.resize(static_cast<std::size_t>(slices) * start[levels] + 1);     // A read landing on the guard touches one past it
+
+        std::vector<double> cycle(oversize);
+        std::vector<std::complex<double>> spectrum(oversize), level(size(0));
+        for(int j = 0; j < slices; ++j)
+        {
+            draw(cycle.data(), oversize, slices > 1 ? -1.0 + 2.0 * j / (slices - 1) : 0.0);
+            for(int i = 0; i < oversize; ++i) spectrum[i] = cycle[i];
+            fft(spectrum.data(), oversize, false);
+
+            for(int m = 0; m < levels; ++m)
+            {
+                const int length = size(m), top = harmonics >> m;
+                std::fill(level.begin(), level.end(), 0.0);
+                level[0] = spectrum[0] / static_cast<double>(oversize);
+                for(int k = 1; k <= top; ++k)
+                {
+                    level[k] = spectrum[k] / static_cast<double>(oversize);
+                    level[length - k] = std::conj(level[k]);
+                }
+                fft(level.data(), length, true);
+
+                float* t = data.data() + j * start[levels] + start[m];
+                for(int i = 0; i < length; ++i) t[i] = static_cast<float>(level[i].real());
+                t[length] = t[0];
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include "constants.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+
+   /***************************************************************************************************************************
+    * 
+    *  Band-limited wavetable
+    *  One cycle of a waveform, drawn once at startup and kept as a mipmap: level m holds the first 512 >> m harmonics,
+    *  so a voice advancing delta radians per sample reads the deepest level whose top harmonic stays under Nyquist.
+    *  Each level is sampled at least 4 times per harmonic, enough for linear interpolation.
+    *  Waveforms with a shape parameter are drawn as slices across w in [-1, 1] and blended between neighbours.
+    *  Reads take one voice per lane, each at its own level.
+    * 
+    **************************************************************************************************************************/
+    class Wavetable
+    {
+        public:
+            static constexpr int levels    = 10;
+            static constexpr int harmonics = 512;           // At level 0
+            using Draw = void (*)(double* cycle, const int n, const double w);    // n samples from phase -pi, shape w
+
+        private:
+            int slices;
+            int start[levels + 1];                          // Level offsets inside a slice, start[levels]: slice stride
+            std::vector<float> data;
+
+        public:
+            static constexpr int size(const int m) noexcept { return std::max(4 * (harmonics >> m), 256); }
+            int offset(const int m) const noexcept { return start[m]; }
+
+            static int level(const float delta) noexcept    // Mip level for a phase increment in radians
+            {
+                const float top = delta * (harmonics / pi);
+                if(top <= 1.0f) return 0;
+                const int e = static_cast<int>(std::bit_cast<std::uint32_t>(top) >> 23) - 127;  // floor(log2), as ilogb
+                return std::min(e + 1, levels - 1);
+            }
+
+            struct Cut { const float* slice; const float* next; float mix; };
+            Cut cut(const float w) const noexcept           // Neighbouring slices of shape w in [-1, 1], clamped
+            {
+                if(slices == 1) return { data.data(), data.data(), 0.0f };
+                const float p = (std::clamp(w, -1.0f, 1.0f) + 1.0f) * 0.5f * (slices - 1);
+                const int j = std::min(static_cast<int>(p), slices - 2);
+                return { data.data() + j * start[levels], data.data() + (j + 1) * start[levels], p - j };
+            }
+
+            static simd::vf read(const float* slice, const simd::vi offset, const simd::vf length, const simd::vf x) noexcept
+            {                                               // Phase x in radians, any range; level per lane: offset, size
+                using namespace simd;
+                vf u = x * set(1.0f / tao) + set(0.5f);
+                u = (u - floor(u)) * length;
+                const vi i = truncate(u);
+                const vf f = u - convert(i);
+                const vi k = i + offset;
+                const vf a = gather(slice, k);
+                return a + f * (gather(slice + 1, k) - a);
+            }
+
+            Wavetable(const Draw, const int slices = 1);
+    };
+}
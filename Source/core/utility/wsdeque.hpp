@@ -0,0 +1,98 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include <atomic>
+
+namespace core {
+
+   /***************************************************************************************************************************
+    * 
+    *  Work stealing deque (Chase-Lev, bounded)
+    *  The owner pushes and pops at the bottom, any other thread steals from the top.
+    *  N must be a power of two.
+    * 
+    **************************************************************************************************************************/
+    template <typename T, int N>
+    class wsdeque
+    {
+        static_assert((N & (N - 1)) == 0, "wsdeque size must be a power of two");
+
+        private:
+            std::atomic<T> data[N];
+            alignas(64) std::atomic<long> top    = 0;       // Thieves
+            alignas(64) std::atomic<long> bottom = 0;       // Owner
+
+        public:
+            bool push(const T&) noexcept;                   // Owner, false when full
+            bool pop(T&) noexcept;                          // Owner, newest first
+            bool steal(T&) noexcept;                        // Any thread, oldest first
+    };
+
+    template <typename T, int N>
+    bool wsdeque<T, N>::push(const T& value) noexcept
+    {
+        const long b = bottom.load(std::memory_order_relaxed);
+        const long t = top.load(std::memory_order_acquire);
+        if(b - t >= N) return false;
+        data[b & (N - 1)].store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    template <typename T, int N>
+    bool wsdeque<T, N>::pop(T& value) noexcept
+    {
+        const long b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long t = top.load(std::memory_order_relaxed);
+
+        if(t > b)                                           // Empty
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        value = data[b & (N - 1)].load(std::memory_order_relaxed);
+        if(t == b)                                          // Last one, race the thieves
+        {
+            const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    template <typename T, int N>
+    bool wsdeque<T, N>::steal(T& value) noexcept
+    {
+        long t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const long b = bottom.load(std::memory_order_acquire);
+        if(t >= b) return false;
+
+        value = data[t & (N - 1)].load(std::memory_order_relaxed);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,59 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#include "voices.hpp"
+#include <algorithm>
+
+namespace core
+{
+    int Voices::find(const uint8_t note) const noexcept
+    {
+        return held[note & 0x7F];
+    }
+
+    void Voices::remove(const int v) noexcept
+    {
+        const int i = slot[v];
+        list[i] = list[--count];
+        slot[list[i]] = i;
+        slot[v] = -1;
+        if(held[key[v]] == v) held[key[v]] = -1;
+        spare[spares++] = v;
+    }
+
+    void Voices::span() noexcept
+    {
+        int top = -1;
+        for(int i = 0; i < count; ++i) top = std::max<int>(top, list[i]);
+        lanes = std::min((top + 8) & ~7, settings::poly);
+    }
+
+    void Voices::clear() noexcept
+    {
+        std::fill_n(held, 128, -1);
+        std::fill_n(slot, settings::poly, -1);
+        count  = 0;
+        lanes  = 0;
+        spares = 0;
+        for(int v = settings::poly - 1; v >= 1; --v) spare[spares++] = v;     // Lowest voice first
+    }
+}
@@ -0,0 +1,115 @@
+/*****************************************************************************************************************************
+* Copyright (c) 2022-2025 POLE
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+******************************************************************************************************************************/
+#pragma once
+#include "constants.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace core
+{
+   /**********************************************************************************************************************
+    * 
+    *  Voices
+    *  Fixed capacity voice allocator, voice 0 is left to the monophonic modes.
+    *  A note maps to its voice through a table, sounding voices are kept in a dense list
+    *  that polyphonic modules slice by shard, so their cost follows the voices in use.
+    *  When every voice sounds, one is stolen by policy. Finished voices are reclaimed
+    *  by collect() between blocks, the list never changes while modules render.
+    * 
+    **********************************************************************************************************************/
+    class Voices
+    {
+        public:
+            enum policy { oldest, quietest };
+
+        private:
+            int8_t held[128];                           // Note -> voice, -1: none
+            uint8_t key[settings::poly] {};             // Voice -> note
+            int slot[settings::poly];                   // Voice -> position in list, -1: free
+            unsigned age[settings::poly] {};            // Allocation stamp
+            uint8_t spare[settings::poly];              // Free voices
+            int spares = 0;
+            unsigned clock = 0;
+            void remove(const int) noexcept;
+            void span() noexcept;
+
+        public:
+            uint8_t list[settings::poly];               // Sounding voices
+            int count = 0;
+            int lanes = 0;                              // Width of a voice bundle: highest sounding voice, rounded up to 8
+            policy steal = oldest;
+            bool retrigger = true;                      // A sounding note played again restarts its voice
+            std::atomic<unsigned> steals = 0;           // Voices taken from a sounding note
+
+            int find(const uint8_t) const noexcept;     // Voice of a note, -1: none
+            template <typename Level>
+            int allocate(const uint8_t, Level&&) noexcept;      // Voice for a note, level(v) for the quietest policy
+            template <typename Done>
+            void collect(Done&&) noexcept;              // Reclaim voices where done(v)
+            void clear() noexcept;
+
+            int first(const int shard) const noexcept { return shard * count / settings::shards; }    // Slice of list
+            int last (const int shard) const noexcept { return first(shard + 1); }
+            Voices() { clear(); }
+    };
+
+    template <typename Level>
+    int Voices::allocate(const uint8_t note, Level&& level) noexcept
+    {
+        int v = held[note & 0x7F];
+        if(v >= 0 && retrigger) return v;
+        if(v >= 0) held[note & 0x7F] = -1;              // Left to its release
+
+        if(spares > 0)
+        {
+            v = spare[--spares];
+            slot[v] = count;
+            list[count++] = v;
+        }
+        else
+        {
+            int victim = 0;
+            for(int i = 1; i < count; ++i)
+            {
+                const int a = list[i], b = list[victim];
+                if(steal == oldest ? age[a] < age[b] : level(a) < level(b)) victim = i;
+            }
+            v = list[victim];
+            if(held[key[v]] == v) held[key[v]] = -1;
+            steals.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        key[v] = note & 0x7F;
+        age[v] = clock++;
+        held[key[v]] = v;
+        span();
+        return v;
+    }
+
+    template <typename Done>
+    void Voices::collect(Done&& done) noexcept
+    {
+        for(int i = count - 1; i >= 0; --i) if(done(list[i])) remove(list[i]);
+        span();
+    }
+}